@@ -9,19 +9,18 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
-#include "SFML/Graphics.hpp"
-#include "ResourceHolder.hpp"
-
-using sf::Sprite;
-using sf::IntRect;
+#include "common.hpp"
 
 ////////////////////////////////////////////////////////////
 /// \brief A component of the main Entity class for game objects
 ///
 /// This class provides the basic interface for texturable objects,
-/// identified by an ID type. A texture holder object provides a
-/// mechanism for loading textures (tilesets in the case of animating sprites)
-/// as a unique_ptr of type sf::Texture
+/// identified by an ID type. It only describes how the object looks
+/// (texture ID, active tile of the tile-set, rotation and colour);
+/// the sprite itself is built from this state by the EntityRenderer,
+/// so the simulation does not depend on SFML Graphics
+///
+/// \see EntityRenderer
 ////////////////////////////////////////////////////////////
 class Animatable
 {
@@ -29,60 +28,56 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Constructor for Animatable class
     ///
-    /// \param textureHolder The textureHolder object, passed by const ref.
-    /// provides a unique_ptr to an sf::Texture for the sprite data member
-    ///
     /// \param type An enum that identifies the Entity type. Defined in common.hpp
     ///
     /// \see Entity
     /// \see common
-    /// \see ResourceHolder
-    /// \see [SFML/Texture](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Texture.php)
     ////////////////////////////////////////////////////////////
-    Animatable(const TextureHolder &textureHolder,
-               const entity::ID type) : _type{type} {}
+    Animatable(const entity::ID type) : _type{type},
+                                        _rotation{0},
+                                        _colour{255, 255, 255, 255} {}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Returns the Sprite object.
+    /// \brief Returns the ID of the texture (tile-set) used to draw the entity
     ///
-    /// A pure virtual method for returning the sprite object.
+    /// \return An enum value (defined in common.hpp) of the texture
+    ////////////////////////////////////////////////////////////
+    const textures::ID getTextureID() const
+    { return _id;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the active tile area of the texture
     ///
-    /// \return The method returns the private data member _sprite
+    /// \return A rect (in pixels) of the current animation frame
     ////////////////////////////////////////////////////////////
-    virtual const Sprite &getSprite()const=0;
+    const common::rect getTextureRect() const
+    { return _rectArea;}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Sets the scale of the entity screen object
+    /// \brief Returns the rotation the entity is drawn with
     ///
-    /// \param scaleX The X scale of the enemy sprite
-    /// \param scaleY The Y scale of the enemy sprite
+    /// \return The angle of rotation in degrees (clockwise)
     ////////////////////////////////////////////////////////////
-    virtual void setScale(float scaleX, float scaleY){}
+    const float getRotation() const
+    { return _rotation;}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Sets the orientation of the entity screen object
+    /// \brief Returns the colour the entity is tinted with when drawn
     ///
-    /// The previous and future positions are converted to vectors at the origin,
-    /// and the final position is then subtracted from the initial position,
-    /// to determine the new pointing vector. Then the sprite of the enemy is
-    /// rotated to match this direction
+    /// \return An RGBA colour (white leaves the texture unchanged)
     ////////////////////////////////////////////////////////////
-    virtual void setOrientation(){}
+    const common::colour getColour() const
+    { return _colour;}
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns the current rotation of the enemy sprite
     ///
     /// \return The angle of rotation of the sprite
     ////////////////////////////////////////////////////////////
-    virtual const float getOrientationAngle() const
+    const float getOrientationAngle() const
     { return _angleOrientation;}
 
 protected:
-    ////////////////////////////////////////////////////////////
-    /// \param The sprite object for the Entity
-    ////////////////////////////////////////////////////////////
-    Sprite _sprite;
-
     ////////////////////////////////////////////////////////////
     /// \param The unique ID identifying the texture for the Entity
     ////////////////////////////////////////////////////////////
@@ -101,7 +96,7 @@ protected:
     ////////////////////////////////////////////////////////////
     /// \param The animatable texture's active tile area
     ////////////////////////////////////////////////////////////
-    IntRect _rectArea;
+    common::rect _rectArea;
 
     ////////////////////////////////////////////////////////////
     /// \param The pixel offset of the _rectArea, moving the image from frame to frame
@@ -113,6 +108,16 @@ protected:
     ////////////////////////////////////////////////////////////
     float _angleOrientation;
 
+    ////////////////////////////////////////////////////////////
+    /// \param The rotation (in degrees) the entity is drawn with
+    ////////////////////////////////////////////////////////////
+    float _rotation;
+
+    ////////////////////////////////////////////////////////////
+    /// \param The colour the entity is tinted with when drawn
+    ////////////////////////////////////////////////////////////
+    common::colour _colour;
+
 };
 
 #endif //PROJECT_ANIMATABLE_HPP
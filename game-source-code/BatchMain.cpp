@@ -0,0 +1,57 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Headless batch runner, for balancing the game
+///
+/// gyruss_batch [games] [seed] [random|scripted] [threads]
+///
+/// Plays the games on every core (or the given number of threads), and
+/// writes one CSV line per game to standard output, and a summary of the
+/// batch to standard error. e.g. gyruss_batch 500 7 > results.csv
+/////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <string>
+#include <SFML/System.hpp>
+#include "BatchRunner.hpp"
+#include "JobSystem.hpp"
+
+int main(int argc, char **argv)
+{
+    auto numberOfGames = 100u;
+    auto seed = std::uint64_t{1};
+    auto policy = BatchRunner::RandomInput;
+    auto numberOfThreads = 0u;
+
+    try
+    {
+        if (argc > 1)
+            numberOfGames = static_cast<unsigned int>(std::stoul(argv[1]));
+        if (argc > 2)
+            seed = std::stoull(argv[2]);
+        if (argc > 3)
+        {
+            auto policyName = std::string{argv[3]};
+            if (policyName == "scripted")
+                policy = BatchRunner::ScriptedInput;
+            else if (policyName != "random")
+                throw std::invalid_argument(policyName);
+        }
+        if (argc > 4)
+            numberOfThreads = static_cast<unsigned int>(std::stoul(argv[4]));
+    }
+    catch (const std::exception&)
+    {
+        std::cerr << "Usage: " << argv[0] << " [games] [seed] [random|scripted] [threads]\n";
+        return 1;
+    }
+
+    JobSystem jobs(numberOfThreads);
+    BatchRunner runner(seed, policy);
+    sf::Clock wallClock;
+    auto results = runner.run(numberOfGames, jobs);
+    auto wallTime = wallClock.getElapsedTime().asSeconds();
+
+    BatchRunner::writeResults(std::cout, results);
+    BatchRunner::writeSummary(std::cerr, results);
+    std::cerr << "Played in " << wallTime << " s on " << jobs.getThreadCount() << " worker threads\n";
+    return 0;
+}
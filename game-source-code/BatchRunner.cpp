@@ -0,0 +1,178 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Runs many seeded games headless, for balancing the game
+/////////////////////////////////////////////////////////////////////
+
+#include "BatchRunner.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <SFML/System.hpp>
+#include "Random.hpp"
+#include "Score.hpp"
+#include "Simulation.hpp"
+
+BatchRunner::BatchRunner(std::uint64_t seed,
+                         InputPolicy policy,
+                         SimulationClock::Ticks maxTicks) : _seed{seed},
+                                                            _policy{policy},
+                                                            _maxTicks{maxTicks}
+{}
+
+GameResult BatchRunner::runGame(unsigned int game) const
+{
+    // The same set up as Game::startGameLoop
+    auto resolution = Vector2i{1920, 1080};
+    auto shipPathRadiusPadding = 0.05f;
+    const auto shipPathRadius = (resolution.y / 2) - (resolution.y * shipPathRadiusPadding);
+    const auto shipScale = 0.22f;
+    auto speedModifier = 0.35f;
+    auto moveAmount = 260.f; // As InputHandler, per second of game time
+
+    auto gameStream = Random{_seed}.substream(game);
+    auto policyStream = gameStream.substream(1);
+    SimulationClock clock;
+    Score score(clock);
+    Simulation simulation(resolution,
+                          shipPathRadius,
+                          shipScale,
+                          score,
+                          clock,
+                          speedModifier,
+                          gameStream.substream(0));
+    auto &input = simulation.getInput();
+
+    sf::Clock tickClock;
+    auto totalTickTime = 0.f;
+    auto maxTickTime = 0.f;
+    while (simulation.getGameState() == game::GameState::Playing
+           && clock.getTicks() < _maxTicks)
+    {
+        auto tick = clock.getTicks();
+        if (_policy == RandomInput)
+        {
+            if (tick % 30 == 0)
+                input.setMove((policyStream.nextInt(3) - 1) * moveAmount);
+            if (policyStream.nextInt(8) == 0)
+                input.shoot();
+        }
+        else
+        {
+            input.setMove((tick % 240 < 120) ? moveAmount : -moveAmount);
+            if (tick % 10 == 0)
+                input.shoot();
+        }
+
+        tickClock.restart();
+        simulation.step();
+        auto tickTime = static_cast<float>(tickClock.getElapsedTime().asMicroseconds());
+        totalTickTime += tickTime;
+        maxTickTime = std::max(maxTickTime, tickTime);
+    }
+
+    GameResult result;
+    result.game = game;
+    result.outcome = simulation.getGameState();
+    result.score = score.getScore();
+    result.enemiesKilled = score.getEnemiesKilled();
+    result.accuracy = score.getPlayerAccuracy();
+    result.longestTimeAlive = std::max(score.getLongestTimeAlive(), score.getTimeAlive());
+    result.ticks = clock.getTicks();
+    result.meanTickTime = result.ticks > 0 ? totalTickTime / result.ticks : 0;
+    result.maxTickTime = maxTickTime;
+    return result;
+}
+
+std::vector<GameResult> BatchRunner::run(unsigned int numberOfGames, JobSystem &jobs) const
+{
+    std::vector<GameResult> results(numberOfGames);
+    for (auto game = 0u; game < numberOfGames; game++)
+        jobs.submit([this, game, &results] {results[game] = runGame(game);});
+    jobs.wait();
+    return results;
+}
+
+namespace
+{
+    const char *outcomeName(game::GameState outcome)
+    {
+        switch (outcome)
+        {
+            case game::GameState::GameOverWin : return "win";
+            case game::GameState::GameOverLose : return "lose";
+            default : return "timeout";
+        }
+    }
+
+    // Mean, standard deviation, minimum and maximum of one statistic over the batch
+    void writeStatistic(std::ostream &output,
+                        const std::string &name,
+                        const std::vector<GameResult> &results,
+                        std::function<double(const GameResult&)> statistic)
+    {
+        auto sum = 0.0;
+        auto sumOfSquares = 0.0;
+        auto minimum = statistic(results.front());
+        auto maximum = minimum;
+        for (const auto &result : results)
+        {
+            auto value = statistic(result);
+            sum += value;
+            sumOfSquares += value * value;
+            minimum = std::min(minimum, value);
+            maximum = std::max(maximum, value);
+        }
+        auto mean = sum / results.size();
+        auto variance = std::max(0.0, sumOfSquares / results.size() - mean * mean);
+        output << std::left << std::setw(20) << name << std::right
+               << " mean " << std::setw(10) << mean
+               << "  sd " << std::setw(10) << std::sqrt(variance)
+               << "  min " << std::setw(10) << minimum
+               << "  max " << std::setw(10) << maximum << '\n';
+    }
+}
+
+void BatchRunner::writeResults(std::ostream &output, const std::vector<GameResult> &results)
+{
+    output << "game,outcome,score,kills,accuracy,longest_alive_s,ticks,mean_tick_us,max_tick_us\n";
+    for (const auto &result : results)
+    {
+        output << result.game << ','
+               << outcomeName(result.outcome) << ','
+               << result.score << ','
+               << result.enemiesKilled << ','
+               << result.accuracy << ','
+               << result.longestTimeAlive << ','
+               << result.ticks << ','
+               << result.meanTickTime << ','
+               << result.maxTickTime << '\n';
+    }
+}
+
+void BatchRunner::writeSummary(std::ostream &output, const std::vector<GameResult> &results)
+{
+    if (results.empty())
+    {
+        output << "No games played\n";
+        return;
+    }
+
+    auto wins = std::count_if(results.begin(), results.end(),
+                              [](const GameResult &result) {return result.outcome == game::GameState::GameOverWin;});
+    auto losses = std::count_if(results.begin(), results.end(),
+                                [](const GameResult &result) {return result.outcome == game::GameState::GameOverLose;});
+    output << results.size() << " games: " << wins << " won, " << losses << " lost, "
+           << results.size() - wins - losses << " timed out\n";
+
+    auto flags = output.flags();
+    output << std::fixed << std::setprecision(2);
+    writeStatistic(output, "score", results, [](const GameResult &result) {return result.score;});
+    writeStatistic(output, "kills", results, [](const GameResult &result) {return result.enemiesKilled;});
+    writeStatistic(output, "accuracy", results, [](const GameResult &result) {return result.accuracy;});
+    writeStatistic(output, "longest alive (s)", results, [](const GameResult &result) {return result.longestTimeAlive;});
+    writeStatistic(output, "length (s)", results,
+                   [](const GameResult &result) {return SimulationClock::toSeconds(result.ticks);});
+    writeStatistic(output, "mean step (us)", results, [](const GameResult &result) {return result.meanTickTime;});
+    writeStatistic(output, "slowest step (us)", results, [](const GameResult &result) {return result.maxTickTime;});
+    output.flags(flags);
+}
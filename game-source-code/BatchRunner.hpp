@@ -0,0 +1,124 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Runs many seeded games headless, for balancing the game
+///
+/// Each game is a Simulation stepped as fast as possible, with no window,
+/// driven by an input policy instead of a player. Games are independent,
+/// so a batch is spread over every core by a JobSystem. The results
+/// (score, kills, accuracy, longest life and step timings) can be written
+/// out as CSV, or summarised
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_BATCHRUNNER_HPP
+#define PROJECT_BATCHRUNNER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "common.hpp"
+#include "SimulationClock.hpp"
+#include "JobSystem.hpp"
+
+////////////////////////////////////////////////////////////
+/// \brief The outcome and statistics of one headless game
+////////////////////////////////////////////////////////////
+struct GameResult
+{
+    unsigned int game;                      /*!< The game's number in the batch */
+    game::GameState outcome;                /*!< GameOverWin, GameOverLose, or Playing if it ran out of time */
+    unsigned int score;                     /*!< The final score */
+    unsigned int enemiesKilled;             /*!< The number of enemies killed */
+    float accuracy;                         /*!< Player bullets that hit, from 0 to 1 */
+    float longestTimeAlive;                 /*!< The longest life, in seconds of game time */
+    SimulationClock::Ticks ticks;           /*!< The number of steps the game lasted */
+    float meanTickTime;                     /*!< The mean real time of a step, in microseconds */
+    float maxTickTime;                      /*!< The slowest step, in microseconds */
+};
+
+////////////////////////////////////////////////////////////
+/// \brief BatchRunner Class
+///
+/// Every game in a batch is seeded from the batch seed and the game's
+/// number, so a game gives the same result whichever thread runs it, and
+/// any single game can be replayed on its own with runGame().
+///
+/// \see Simulation
+/// \see JobSystem
+////////////////////////////////////////////////////////////
+class BatchRunner
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief How the playerShip is controlled
+    ////////////////////////////////////////////////////////////
+    enum InputPolicy
+    {
+        RandomInput,    /*!< A random move every half second, and random shots */
+        ScriptedInput   /*!< Sweeps back and forth, shooting at a steady rate */
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param seed The seed of the batch
+    /// \param policy How the playerShip is controlled
+    /// \param maxTicks The longest a game may run, in steps (20 minutes by default)
+    ////////////////////////////////////////////////////////////
+    BatchRunner(std::uint64_t seed,
+                InputPolicy policy,
+                SimulationClock::Ticks maxTicks = 20 * 60 * 60);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Plays one game of the batch to the end, on the calling thread
+    ///
+    /// \param game The game's number in the batch
+    /// \return The outcome and statistics of the game
+    ////////////////////////////////////////////////////////////
+    GameResult runGame(unsigned int game) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Plays games 0 to numberOfGames-1, spread over the job system's threads
+    ///
+    /// \param numberOfGames The number of games to play
+    /// \param jobs The threads to play them on
+    /// \return The result of each game, in game order
+    ////////////////////////////////////////////////////////////
+    std::vector<GameResult> run(unsigned int numberOfGames, JobSystem &jobs) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Writes one line of comma separated values per game, after a header line
+    ///
+    /// \param output The stream to write to
+    /// \param results The results of a batch
+    ////////////////////////////////////////////////////////////
+    static void writeResults(std::ostream &output, const std::vector<GameResult> &results);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Writes the number of wins and losses, and the mean, standard
+    /// deviation, minimum and maximum of each statistic
+    ///
+    /// \param output The stream to write to
+    /// \param results The results of a batch
+    ////////////////////////////////////////////////////////////
+    static void writeSummary(std::ostream &output, const std::vector<GameResult> &results);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief The seed of the batch
+    ////////////////////////////////////////////////////////////
+    std::uint64_t _seed;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief How the playerShip is controlled
+    ////////////////////////////////////////////////////////////
+    InputPolicy _policy;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The longest a game may run, in steps
+    ////////////////////////////////////////////////////////////
+    SimulationClock::Ticks _maxTicks;
+};
+
+#endif //PROJECT_BATCHRUNNER_HPP
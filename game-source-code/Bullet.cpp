@@ -11,23 +11,17 @@ Bullet::Bullet(const Vector2i resolution,
                float angle,
                float scale,
                const entity::ID type,
-               const TextureHolder &textureHolder,
                const textures::ID id) : Entity{resolution,
                                                distanceFromCentre,
                                                angle,
                                                scale,
-                                               type,
-                                               textureHolder}
+                                               type}
 {
     _id = id;
     _lives = 1;
     _rectArea = {0, 0, 70, 110}; // Individual sprite tile
     _spriteOffset = _rectArea.width; // Animated sprite tileset width
-    _sprite.setTexture(textureHolder.get(_id));
-    _sprite.setTextureRect(_rectArea);
-    _sprite.setOrigin(_sprite.getGlobalBounds().width / 2, _sprite.getGlobalBounds().height / 2);
-    _sprite.setScale(_scale, _scale);
-    _sprite.setRotation(-_angle);
+    _rotation = -_angle;
     _isMoving = true;
     setMove(0); // Spawn at Ship Gun barrel
     update();
@@ -42,8 +36,10 @@ void Bullet::setMove(float distance)
 void Bullet::reset()
 {
     _isMoving = false;
-    _sprite.setPosition(_resolution.x*2,_resolution.y*2); // Move off-screen
-    _sprite.setScale(0,0);
+    setScreenPosition({float(_resolution.x*2), float(_resolution.y*2)}); // Move off-screen
+    _screenScale = {0, 0};
+    updateCollisionCircle();
+    storePreviousState();
 }
 
 void Bullet::update()
@@ -58,7 +54,6 @@ void Bullet::update()
             {
                 _rectArea.left = 0;
             }
-            _sprite.setTextureRect(_rectArea);
         } else
         {
             _animationFPSLimit++;
@@ -67,52 +62,10 @@ void Bullet::update()
     }
 }
 
-const float Bullet::getRadius() const
-{
-    auto mid = Vector2f{_resolution.x/2.f,_resolution.y/2.f};
-    auto pos = Vector2f{_sprite.getPosition().x,_sprite.getPosition().y};
-    Vector2f length = mid-pos;
-    return sqrt((length.x * length.x) + (length.y * length.y));
-}
-
 const float Bullet::getDistanceFromCentre() const
 {
-    return _distanceFromCentre - _sprite.getGlobalBounds().height/2;
-}
-
-const float Bullet::getAngle() const
-{
-    return _angle;
-}
-
-const Vector2f Bullet::getPosition() const
-{
-    return _sprite.getPosition();
-}
-
-const Sprite& Bullet::getSprite() const
-{
-    return _sprite;
-}
-
-const Vector2f Bullet::getScale() const
-{
-    return _sprite.getScale();
-}
-
-const int Bullet::getLives() const
-{
-    return _lives;
-}
-
-const entity::ID  Bullet::getType() const
-{
-    return _type;
-}
-
-const bool Bullet::isAlive() const
-{
-    return _isAlive;
+    checkCachedKinematics();
+    return _distanceFromCentre - _boundsSize.y/2;
 }
 
 void Bullet::die()
@@ -133,15 +86,14 @@ void Bullet::move()
 
     auto depthScale = ((_distanceFromCentre + offset)/(_resolution.y/2));
     _distanceFromCentre += _futureMoveValue * depthScale;
-    auto x_pos = _distanceFromCentre * sin(common::degreeToRad(_angle));
-    auto y_pos = _distanceFromCentre * cos(common::degreeToRad(_angle));
-    auto scale = 1 + ((getRadius() - (_resolution.y / 2)) / (_resolution.y / 2));
-    _sprite.setPosition(x_pos+(_resolution.x / 2),y_pos+(_resolution.y / 2));
-    _sprite.setScale(scale * _scale,scale * _scale);
+    setPolarPosition(_distanceFromCentre, _angle);
+    auto scale = 1 + ((_polarRadius - (_resolution.y / 2)) / (_resolution.y / 2));
+    _screenScale = {scale * _scale, scale * _scale};
 
     // Dimming
-    auto dimColor = (scale*200) + 55;
-    if (getRadius() >= (_resolution.y/2))
+    auto dimColor = static_cast<unsigned char>((scale*200) + 55);
+    if (_polarRadius >= (_resolution.y/2))
 
-    _sprite.setColor(Color(dimColor,dimColor,dimColor));
+    _colour = {dimColor, dimColor, dimColor, 255};
+    updateCollisionCircle();
 }
\ No newline at end of file
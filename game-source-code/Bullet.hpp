@@ -11,20 +11,16 @@
 #include <cmath>
 #include "common.hpp"
 #include "Entity.hpp"
-#include "ResourceHolder.hpp"
 
 using sf::Vector2f;
 using sf::Vector2i;
-using sf::IntRect;
-using sf::Sprite;
-using sf::Color;
 
 ////////////////////////////////////////////////////////////
 /// \brief Projectile class, for either Player or Enemy bullets.
 ///
 /// Inherits from the Entity base class.
 ////////////////////////////////////////////////////////////
-class Bullet : public Entity
+class Bullet final : public Entity
 {
 public:
     ////////////////////////////////////////////////////////////
@@ -44,20 +40,16 @@ public:
     /// and scaled by distance from the origin in the move() command.
     /// \param type An enum that identifies the Entity type. Defined in common.hpp,
     /// passed to the Animatable base class
-    /// \param textureHolder The textureHolder object, passed by const ref.
-    /// provides a unique_ptr to an sf::Texture for the sprite data member
     /// \param id The unique ID identifying the texture for the Entity
     ///
     /// \see Entity
     /// \see common
-    /// \see ResourceHolder
     ///////////////////////////////////////////////////////////////
     Bullet(const Vector2i resolution,
            float distanceFromCentre,
            float angle,
            float scale,
            const entity::ID type,
-           const TextureHolder &textureHolder,
            const textures::ID id);
 
     ////////////////////////////////////////////////////////////
@@ -69,113 +61,36 @@ public:
     /// \param distance How far the bullet should move for the next frame
     /// (in screen space)
     ////////////////////////////////////////////////////////////
-    void setMove(float distance) override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Sets the future movement, by both angle and distance
-    ///
-    ///
-    /// \param angle The delta change in angle (will be added to
-    /// the current angle
-    /// \param distance The delta change in distance (will be added to
-    /// the current distance
-    ///
-    /// \see move
-    ////////////////////////////////////////////////////////////
-    void setMove(float angle, float distance) override {};
+    void setMove(float distance);
 
     ////////////////////////////////////////////////////////////
     /// \brief Performs the actual move, based on _futureMoveValue.
     ///////////////////////////////////////////////////////////////
-    void move() override;
+    void move();
 
     ////////////////////////////////////////////////////////////
     /// \brief Resets the bullet (intended to be called after
     /// a collision with the bullet)
     ////////////////////////////////////////////////////////////
-    void reset() override;
+    void reset();
 
     ////////////////////////////////////////////////////////////
     /// \brief Checks and updates the movement, shooting and calls
     /// the actual movement translation with move()
     ////////////////////////////////////////////////////////////
-    void update() override;
+    void update();
 
     ////////////////////////////////////////////////////////////
     /// \brief Decrements the bullet lives
     ////////////////////////////////////////////////////////////
-    void die() override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the Sprite object of the Class by ref
-    ///
-    /// \return The sf::Sprite object representing the position,
-    /// dimensions and texture of the bullet
-    ///
-    /// \see [SFML/Sprite](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Sprite.php)
-    ////////////////////////////////////////////////////////////
-    const Sprite &getSprite() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the distance from origin (screen space)
-    ///
-    /// \return A float value of the distance from centre of the screen
-    ////////////////////////////////////////////////////////////
-    const float getRadius() const override;
+    void die();
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns the distance from origin (non-linear distance)
     ///
     /// \return A float value, the depth from the centre in z
     ////////////////////////////////////////////////////////////
-    const float getDistanceFromCentre() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the current angle of the bullet,
-    /// measured from the origin( mid-point screen space)
-    ///
-    /// \return A float value, the angle around the screen centre origin
-    ////////////////////////////////////////////////////////////
-    const float getAngle() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the x,y position of the bullet on screen
-    ///
-    /// \return An sf:Vector2f (two float values) of the {x,y} position of the bullet
-    /// \see [SFML/Vector2](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Vector2.php)
-    ////////////////////////////////////////////////////////////
-    const Vector2f getPosition() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the scale (in width/height) of the bullet object
-    ///
-    /// \return An sf:Vector2f (two float values) of the {x,y} scale of the bullet
-    /// \see [SFML/Vector2](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Vector2.php)
-    ////////////////////////////////////////////////////////////
-    const Vector2f getScale() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the remaining number of lives of the bullet
-    ///
-    /// \return An integer value of the remaining bullet lives (usually 0 or 1)
-    ////////////////////////////////////////////////////////////
-    const int getLives() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Boolean state of the entity (alive/dead)
-    ///
-    /// \return A boolean value of alive(1) or dead(0)
-    ////////////////////////////////////////////////////////////
-    const bool isAlive() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the entity type
-    ///
-    /// \return An enum value (defined in common.hpp) of the entity type
-    /// \see common
-    /// \see Entity
-    ////////////////////////////////////////////////////////////
-    const entity::ID getType() const override;
+    const float getDistanceFromCentre() const;
 
 };
 
@@ -0,0 +1,93 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Implementation of the batched circle-overlap test
+/////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include "CollisionKernel.hpp"
+#include "Simd.hpp"
+
+namespace collision
+{
+    std::uint32_t overlapMask(Vector2f centre,
+                              float radius,
+                              const CircleArray &circles,
+                              std::size_t first,
+                              std::size_t count)
+    {
+        count = std::min(count, batchSize);
+        const auto *x = circles.x.data() + first;
+        const auto *y = circles.y.data() + first;
+        const auto *r = circles.radius.data() + first;
+
+        auto mask = std::uint32_t{0};
+        auto i = std::size_t{0};
+
+        // Each wider path handles as much of the batch as fits, and leaves the
+        // remainder to the narrower paths below it
+#if defined(__AVX512F__)
+        {
+            auto centreX = _mm512_set1_ps(centre.x);
+            auto centreY = _mm512_set1_ps(centre.y);
+            auto circleRadius = _mm512_set1_ps(radius);
+            for (; i + 16 <= count; i += 16)
+            {
+                auto distanceX = _mm512_sub_ps(_mm512_loadu_ps(x + i), centreX);
+                auto distanceY = _mm512_sub_ps(_mm512_loadu_ps(y + i), centreY);
+                auto reach = _mm512_add_ps(_mm512_loadu_ps(r + i), circleRadius);
+                auto distanceSquared = _mm512_add_ps(_mm512_mul_ps(distanceX, distanceX),
+                                                     _mm512_mul_ps(distanceY, distanceY));
+                auto hits = _mm512_cmp_ps_mask(distanceSquared, _mm512_mul_ps(reach, reach), _CMP_LE_OQ);
+                mask |= static_cast<std::uint32_t>(hits) << i;
+            }
+        }
+#endif
+
+#if defined(__AVX2__)
+        {
+            auto centreX = _mm256_set1_ps(centre.x);
+            auto centreY = _mm256_set1_ps(centre.y);
+            auto circleRadius = _mm256_set1_ps(radius);
+            for (; i + 8 <= count; i += 8)
+            {
+                auto distanceX = _mm256_sub_ps(_mm256_loadu_ps(x + i), centreX);
+                auto distanceY = _mm256_sub_ps(_mm256_loadu_ps(y + i), centreY);
+                auto reach = _mm256_add_ps(_mm256_loadu_ps(r + i), circleRadius);
+                auto distanceSquared = _mm256_add_ps(_mm256_mul_ps(distanceX, distanceX),
+                                                     _mm256_mul_ps(distanceY, distanceY));
+                auto hits = _mm256_cmp_ps(distanceSquared, _mm256_mul_ps(reach, reach), _CMP_LE_OQ);
+                mask |= static_cast<std::uint32_t>(_mm256_movemask_ps(hits)) << i;
+            }
+        }
+#endif
+
+#if defined(GYRUSS_SSE2)
+        {
+            auto centreX = _mm_set1_ps(centre.x);
+            auto centreY = _mm_set1_ps(centre.y);
+            auto circleRadius = _mm_set1_ps(radius);
+            for (; i + 4 <= count; i += 4)
+            {
+                auto distanceX = _mm_sub_ps(_mm_loadu_ps(x + i), centreX);
+                auto distanceY = _mm_sub_ps(_mm_loadu_ps(y + i), centreY);
+                auto reach = _mm_add_ps(_mm_loadu_ps(r + i), circleRadius);
+                auto distanceSquared = _mm_add_ps(_mm_mul_ps(distanceX, distanceX),
+                                                  _mm_mul_ps(distanceY, distanceY));
+                auto hits = _mm_cmple_ps(distanceSquared, _mm_mul_ps(reach, reach));
+                mask |= static_cast<std::uint32_t>(_mm_movemask_ps(hits)) << i;
+            }
+        }
+#endif
+
+        // Scalar fallback, and the last few circles of the batch
+        for (; i < count; i++)
+        {
+            auto distanceX = x[i] - centre.x;
+            auto distanceY = y[i] - centre.y;
+            auto reach = r[i] + radius;
+            if (distanceX * distanceX + distanceY * distanceY <= reach * reach)
+                mask |= std::uint32_t{1} << i;
+        }
+
+        return mask;
+    }
+}
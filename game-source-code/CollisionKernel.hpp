@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Batched circle-overlap test, used as the collision narrow-phase
+///
+/// Tests one circle against a run of circles stored as flat arrays, several
+/// at a time with SIMD instructions where the compiler targets them
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_COLLISIONKERNEL_HPP
+#define PROJECT_COLLISIONKERNEL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <SFML/System.hpp>
+
+using sf::Vector2f;
+
+namespace collision
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Collision circles stored as separate x, y and radius arrays
+    ///
+    /// Entity objects are too large to load several centres into one
+    /// register, so their circles are gathered into these arrays first.
+    /// The arrays keep their memory when cleared
+    ////////////////////////////////////////////////////////////
+    struct CircleArray
+    {
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> radius;
+
+        void clear()
+        {
+            x.clear();
+            y.clear();
+            radius.clear();
+        }
+
+        void push_back(Vector2f centre, float circleRadius)
+        {
+            x.push_back(centre.x);
+            y.push_back(centre.y);
+            radius.push_back(circleRadius);
+        }
+
+        std::size_t size() const
+        {return x.size();}
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The largest number of circles tested by one call to overlapMask
+    /// (one bit of the mask each)
+    ////////////////////////////////////////////////////////////
+    constexpr std::size_t batchSize = 32;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tests one circle against a run of circles
+    ///
+    /// Two circles overlap if the distance between their centres is no more
+    /// than the sum of their radii (the same test as EntityController::collides).
+    /// With AVX-512, AVX2 or SSE2 enabled, 16, 8 or 4 circles are tested per
+    /// instruction, otherwise the circles are tested one at a time.
+    ///
+    /// \param centre The centre of the circle to test
+    /// \param radius The radius of the circle to test
+    /// \param circles The circles to test against
+    /// \param first The index in circles of the first circle to test
+    /// \param count The number of circles to test (at most batchSize)
+    ///
+    /// \return A mask with bit i set if the circle overlaps circles[first + i]
+    ////////////////////////////////////////////////////////////
+    std::uint32_t overlapMask(Vector2f centre,
+                              float radius,
+                              const CircleArray &circles,
+                              std::size_t first,
+                              std::size_t count);
+}
+
+#endif //PROJECT_COLLISIONKERNEL_HPP
@@ -9,26 +9,28 @@ Enemy::Enemy(const Vector2i &resolution,
              float angle,
              float scale,
              const entity::ID type,
-             const TextureHolder &textureHolder,
              const textures::ID id,
              MovementState movementState,
-             MovementDirection movementDirection) : Entity{resolution,
-                                                           distanceFromCentre,
-                                                           angle,
-                                                           scale,
-                                                           type,
-                                                           textureHolder}
+             MovementDirection movementDirection,
+             Random random) : Entity{resolution,
+                                     distanceFromCentre,
+                                     angle,
+                                     scale,
+                                     type},
+                              _random{random},
+                              _centreDistance{0},
+                              _ticksSinceShot{0},
+                              _ticksAlive{0}
 {
     _id = id;
     _lives = 1;
-    _sprite.setTexture(textureHolder.get(_id));
-    _sprite.setOrigin(_sprite.getGlobalBounds().width / 2, _sprite.getGlobalBounds().height / 2);
-    _sprite.setScale(_scale, _scale);
+    _rectArea = textures::getFrame(_id); // Whole texture, not animated
     _isShooting = false;
     _movementState = movementState;
     _movementDirection = movementDirection;
-    _centre = {0,0};
+    setCentre({0,0});
     setMove(angle, distanceFromCentre, _centre); //Initialised position at starting point
+    updateCollisionCircle();
 }
 
 void Enemy::setMove(float angle, float distance)
@@ -36,7 +38,7 @@ void Enemy::setMove(float angle, float distance)
     _isMoving = true;
     _futureAngleValue = angle;
     _futureMoveValue = distance;
-    _centre = {0,0};
+    setCentre({0,0});
 }
 
 void Enemy::setMove(float angle, float distance, Vector2f centre)
@@ -44,7 +46,17 @@ void Enemy::setMove(float angle, float distance, Vector2f centre)
     _isMoving = true;
     _futureAngleValue = angle;
     _futureMoveValue = distance;
-    _centre = centre;
+    setCentre(centre);
+}
+
+void Enemy::setCentre(Vector2f centre)
+{
+    // The offset only changes when circling, so the sqrt is rarely needed
+    if (centre != _centre)
+    {
+        _centre = centre;
+        _centreDistance = sqrt((_centre.x * _centre.x) + (_centre.y * _centre.y));
+    }
 }
 
 void Enemy::setMovementState(MovementState movementState)
@@ -55,14 +67,16 @@ void Enemy::setMovementState(MovementState movementState)
 void Enemy::reset()
 {
     _angleOrientation = 0;
-    _sprite.setScale(0, 0);
-    _sprite.setPosition(_resolution.x / 2, _resolution.y / 2);
+    _screenScale = {0, 0};
+    _position = {float(_resolution.x / 2), float(_resolution.y / 2)};
+    _polarRadius = 0;
+    _polarAngle = 0;
     _isShooting = false;
-    _centre = {0, 0};
+    setCentre({0, 0});
     // if the ship is a wanderer and hits the side of the screen, needs to respawn with its previous movement type
     if (_movementState == MovementState::Wandering)
     {
-        _angle = rand() % 360;
+        _angle = _random.nextInt(360);
         _distanceFromCentre = _resolution.y / 7;
         _movementState = MovementState::Wandering;
     }
@@ -72,10 +86,14 @@ void Enemy::reset()
         _distanceFromCentre = 0;
         _movementState = MovementState::SpiralOut;
     }
+    updateCollisionCircle();
+    storePreviousState();
 }
 
 void Enemy::update()
 {
+    _ticksSinceShot++;
+    _ticksAlive++;
     if (_isMoving)
     {
         move();
@@ -86,59 +104,15 @@ void Enemy::update()
     }
 }
 
-const float Enemy::getRadius() const
-{
-    auto xPos = _sprite.getPosition().x - _resolution.x/2;
-    auto yPos = _sprite.getPosition().y - _resolution.y/2;
-
-    return sqrt((xPos*xPos) + (yPos*yPos));
-}
-
 const float Enemy::getDistanceFromCentre() const
 {
-    auto hypotenuse = sqrt((_centre.x * _centre.x) + (_centre.y * _centre.y));
-    return (_distanceFromCentre + hypotenuse) - (_sprite.getGlobalBounds().height / 2);
-}
-
-const Vector2f Enemy::getCentre() const
-{
-    return _centre;
-}
-
-const MovementState Enemy::getMovementState() const
-{
-    return _movementState;
-}
-
-const int Enemy::getMovementDirectionSign() const
-{
-    // Swaps the direction of the angle increase
-    switch (_movementDirection)
-    {
-        case (MovementDirection::CounterClockwise) :
-            return -1;
-        case (MovementDirection::Clockwise) :
-            return 1;
-    }
-    return 1;
-}
-
-const Vector2f Enemy::getPosition() const
-{
-    return _sprite.getPosition();
-}
-
-const Sprite &Enemy::getSprite() const
-{
-    return _sprite;
-}
-
-const Vector2f Enemy::getScale() const
-{
-    return _sprite.getScale();
+    checkCachedKinematics();
+#ifdef GYRUSS_CHECK_CACHE
+    assert(_centreDistance == float(sqrt((_centre.x * _centre.x) + (_centre.y * _centre.y))));
+#endif
+    return (_distanceFromCentre + _centreDistance) - (_boundsSize.y / 2);
 }
 
-
 void Enemy::die()
 {
     _lives--;
@@ -148,44 +122,11 @@ void Enemy::die()
     }
 }
 
-const int Enemy::getLives() const
-{
-    return _lives;
-}
-
-const bool Enemy::isAlive() const
-{
-    return _isAlive;
-}
-
-const entity::ID Enemy::getType() const
-{
-    return _type;
-}
-
 void Enemy::setShoot()
 {
     _isShooting = true;
 }
 
-const bool Enemy::isShooting() const
-{
-    return _isShooting;
-}
-
-const float Enemy::getAngle() const
-{
-    auto x_pos = _sprite.getPosition().x - _resolution.x/2;
-    auto y_pos = _sprite.getPosition().y - _resolution.y/2;
-    auto radianAngle = atan2(x_pos,y_pos);
-    return common::angleFilter(common::radToDegree(radianAngle));
-}
-
-const float Enemy::getOrientationAngle() const
-{
-    return _angleOrientation;
-}
-
 void Enemy::stopShoot()
 {
     _isShooting = false;
@@ -193,13 +134,14 @@ void Enemy::stopShoot()
 
 void Enemy::setScale(float scaleX, float scaleY)
 {
-    _sprite.setScale(scaleX, scaleY);
+    _screenScale = {scaleX, scaleY};
+    updateCollisionCircle();
 }
 
 void Enemy::move()
 {
     // Store old position
-    _prevPosition = _sprite.getPosition();
+    _prevPosition = _position;
     _prevPosition.x -= _resolution.x/2;
     _prevPosition.y -= _resolution.y/2;
 
@@ -212,41 +154,45 @@ void Enemy::move()
     }
     auto depthScale = ((_distanceFromCentre + offset)/(_resolution.x/2));
     _distanceFromCentre += (_futureMoveValue) * depthScale;
-    auto xPos = _distanceFromCentre * sin(common::degreeToRad(_angle))+_centre.x;
-    auto yPos = _distanceFromCentre * cos(common::degreeToRad(_angle))+_centre.y;
-    auto scale = 1 + ((getRadius() - (_resolution.x / 2)) / (_resolution.x / 2));
-
-    _sprite.setPosition(xPos+(_resolution.x / 2),yPos+(_resolution.y / 2));
-    _sprite.setScale(scale * _scale,scale * _scale);
+    if (_centre.x == 0 && _centre.y == 0)
+    {
+        setPolarPosition(_distanceFromCentre, _angle);
+    }
+    else
+    {
+        // Circling an offset centre, so the distance and angle from the screen centre are found from the position
+        float sine, cosine;
+        fastmath::sinCosDegrees(_angle, sine, cosine);
+        auto xPos = _distanceFromCentre * sine + _centre.x;
+        auto yPos = _distanceFromCentre * cosine + _centre.y;
+        setScreenPosition({xPos + (_resolution.x / 2), yPos + (_resolution.y / 2)});
+    }
+    auto scale = 1 + ((_polarRadius - (_resolution.x / 2)) / (_resolution.x / 2));
+    _screenScale = {scale * _scale, scale * _scale};
     // Dimming
-    auto dimColor = (scale*55) + 200;
-    _sprite.setColor(Color(dimColor,dimColor,dimColor));
+    auto dimColor = static_cast<unsigned char>((scale*55) + 200);
+    _colour = {dimColor, dimColor, dimColor, 255};
 
     setOrientation();
+    updateCollisionCircle();
 }
 
 void Enemy::setOrientation()
 {
     // Orientation
-    _newPosition = _sprite.getPosition();
+    _newPosition = _position;
     _newPosition.x -= _resolution.x/2;
     _newPosition.y -= _resolution.y/2;
     _pointingPosition = _newPosition - _prevPosition;
-    _angleOrientation = _futureAngleValue = atan2(_pointingPosition.x,_pointingPosition.y) - atan2(_prevPosition.x,_prevPosition.y);
-    _angleOrientation = -1*common::radToDegree(_angleOrientation) - getAngle();
-    _sprite.setRotation(_angleOrientation);
-}
-const float Enemy::getShootTimerElapsedTime() const
-{
-    return _timerShoot.getElapsedTime().asSeconds();
+    _angleOrientation = fastmath::atan2Degrees(_pointingPosition.x,_pointingPosition.y)
+                        - fastmath::atan2Degrees(_prevPosition.x,_prevPosition.y);
+    _futureAngleValue = common::degreeToRad(_angleOrientation);
+    _angleOrientation = -1*_angleOrientation - _polarAngle;
+    _rotation = _angleOrientation;
 }
 
 void Enemy::resetShootTimer()
 {
-    _timerShoot.restart();
+    _ticksSinceShot = 0;
 }
 
-const float Enemy::getAliveTimeElapsedTime() const
-{
-    return _timerAlive.getElapsedTime().asSeconds();
-}
\ No newline at end of file
@@ -11,13 +11,11 @@
 #include <cmath>
 #include "common.hpp"
 #include "Entity.hpp"
-#include "ResourceHolder.hpp"
+#include "Random.hpp"
+#include "SimulationClock.hpp"
 
 using sf::Vector2f;
 using sf::Vector2i;
-using sf::Color;
-using sf::Clock;
-using sf::Sprite;
 
 ////////////////////////////////////////////////////////////
 /// \brief Abstract Base Class for enemy game objects
@@ -26,7 +24,7 @@ using sf::Sprite;
 ///
 /// \see Entity
 ////////////////////////////////////////////////////////////
-class Enemy : public Entity
+class Enemy final : public Entity
 {
 public:
     ////////////////////////////////////////////////////////////
@@ -40,21 +38,20 @@ public:
     /// \param scale The scale of the sprite
     /// \param type An enum that identifies the Enemy type. Defined in common.hpp,
     /// passed to the Animatable base class
-    /// \param textureHolder The textureHolder object, passed by const ref.
-    /// provides a unique_ptr to an sf::Texture for the sprite data member
     /// \param id The unique ID identifying the texture for the Enemy variant
     /// \param movementState Enum identifying the pattern of movement for the Enemy
     /// \param movementDirection Enum for the movement direction (clockwise or counterclockwise)
+    /// \param random The random stream for this enemy (a substream of the EntityController's stream)
     ////////////////////////////////////////////////////////////
     Enemy(const sf::Vector2i &resolution,
           float distanceFromCentre,
           float angle,
           float scale,
           const entity::ID type,
-          const TextureHolder &textureHolder,
           const textures::ID id,
           MovementState movementState,
-          MovementDirection movementDirection);
+          MovementDirection movementDirection,
+          Random random = Random{});
 
     ////////////////////////////////////////////////////////////
     /// \brief Sets up the next frame's position for the object.
@@ -66,17 +63,7 @@ public:
     /// with 0 being the positive horizontal x axis, with the centre of the screen as the origin)
     /// \param distance How far the enemy should move for the next frame (in screen space)
     ////////////////////////////////////////////////////////////
-    void setMove(float angle, float distance) override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Sets the future movement, either by change in angle or change in distance
-    ///
-    /// \param value The delta change in angle or distance (will be added to
-    /// the current angle/distance
-    ///
-    /// \see move
-    ////////////////////////////////////////////////////////////
-    void setMove(float value) override {};
+    void setMove(float angle, float distance);
 
     ////////////////////////////////////////////////////////////
     /// \brief Sets up the next frame's position for the object, with a different screen origin
@@ -89,7 +76,7 @@ public:
     /// \param distance How far the enemy should move for the next frame (in screen space)
     /// \param centre The coordinate {x,y} to be considered as the origin for this move
     ////////////////////////////////////////////////////////////
-    void setMove(float angle, float distance, Vector2f centre) override;
+    void setMove(float angle, float distance, Vector2f centre);
 
     ////////////////////////////////////////////////////////////
     /// \brief Sets the movement state of the enemy
@@ -98,7 +85,7 @@ public:
     ///
     /// \see MovementDirection
     ////////////////////////////////////////////////////////////
-    void setMovementState(MovementState movementState) override;
+    void setMovementState(MovementState movementState);
 
     ////////////////////////////////////////////////////////////
     /// \brief Sets the scale of the Enemy screen object
@@ -106,7 +93,7 @@ public:
     /// \param scaleX The X scale of the enemy sprite
     /// \param scaleY The Y scale of the enemy sprite
     ////////////////////////////////////////////////////////////
-    void setScale(float scaleX, float scaleY) override;
+    void setScale(float scaleX, float scaleY);
 
     ////////////////////////////////////////////////////////////
     /// \brief Sets the orientation of the Enemy screen object
@@ -116,29 +103,29 @@ public:
     /// to determine the new pointing vector. Then the sprite of the enemy is
     /// rotated to match this direction
     ////////////////////////////////////////////////////////////
-    void setOrientation() override;
+    void setOrientation();
 
     ////////////////////////////////////////////////////////////
     /// \brief Sets the _isShooting state of the enemy
     ////////////////////////////////////////////////////////////
-    void setShoot() override;
+    void setShoot();
 
     ////////////////////////////////////////////////////////////
     /// \brief Resets the object timer, measuring when the enemy last shot a bullet
     ////////////////////////////////////////////////////////////
-    void resetShootTimer() override;
+    void resetShootTimer();
 
     ////////////////////////////////////////////////////////////
     /// \brief Moves the enemy ship around screen space (performs the planned move)
     ////////////////////////////////////////////////////////////
-    void move() override;
+    void move();
 
     ////////////////////////////////////////////////////////////
     /// \brief Resets the enemy (after an enemy is killed, or leaves the outer circle)
     ///
     /// The enemy position is reset back to the centre of the screen.
     ////////////////////////////////////////////////////////////
-    void reset() override;
+    void reset();
 
     ////////////////////////////////////////////////////////////
     /// \brief Checks and updates the movement, shooting and calls
@@ -146,140 +133,78 @@ public:
     ///
     /// \see move
     ////////////////////////////////////////////////////////////
-    void update() override;
+    void update();
 
     ////////////////////////////////////////////////////////////
     /// \brief Decrements the enemy's lives
     ////////////////////////////////////////////////////////////
-    void die() override;
+    void die();
 
     ////////////////////////////////////////////////////////////
-    /// \brief Returns the Sprite object of the Class by ref
-    ///
-    /// \return The sf::Sprite object representing the entity in the game
-    /// (dimensions, position, texture)
+    /// \brief Returns amount of game time since the enemy last shot a bullet
     ///
-    /// \see [SFML/Sprite](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Sprite.php)
+    /// \return A float value (in seconds) of the amount of elapsed time
     ////////////////////////////////////////////////////////////
-    const Sprite &getSprite() const override;
+    const float getShootTimerElapsedTime() const
+    {return SimulationClock::toSeconds(_ticksSinceShot);}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Returns the distance from origin (screen space)
+    /// \brief Returns the amount of game time that the enemy has been alive for.
     ///
-    /// \return A float value, the distance from the origin (on camera plane)
+    /// \return A float value (in seconds) of the time the enemy object has been alive.
     ////////////////////////////////////////////////////////////
-    const float getRadius() const override;
+    const float getAliveTimeElapsedTime() const
+    {return SimulationClock::toSeconds(_ticksAlive);}
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns the distance from origin (non-linear distance)
     ///
     /// \return A float value, the depth from the centre in z
     ////////////////////////////////////////////////////////////
-    const float getDistanceFromCentre() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the current angle of the enemy from the origin(screen space)
-    ///
-    /// \return A float value, the angle around the screen centre origin
-    ////////////////////////////////////////////////////////////
-    const float getAngle() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the current rotation of the enemy sprite
-    ///
-    /// \return The angle of rotation of the sprite
-    ////////////////////////////////////////////////////////////
-    const float getOrientationAngle() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the current rotation of the enemy sprite
-    ///
-    /// \return The angle of rotation of the sprite
-    ////////////////////////////////////////////////////////////
-    const Vector2f getPosition() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the width/height scale of the enemy on screen
-    ///
-    /// \return An sf:Vector2f (two float values) of the {x,y} scale of the enemy
-    ////////////////////////////////////////////////////////////
-    const Vector2f getScale() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the remaining number of lives of the enemy
-    ///
-    /// \return An integer value of the remaining enemy lives (usually 0 or 1)
-    ////////////////////////////////////////////////////////////
-    const int getLives() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the entity type of the enemy
-    ///
-    /// \return An enum value (defined in common.hpp) of the entity type
-    /// \see common
-    /// \see Entity
-    ////////////////////////////////////////////////////////////
-    const entity::ID getType() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Boolean state of the entity (alive/dead)
-    ///
-    /// \return A boolean value of alive(1) or dead(0)
-    ////////////////////////////////////////////////////////////
-    const bool isAlive() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the x/y position of the _centre member of the enemy on screen
-    ///
-    /// \return An sf:Vector2f (two float values) of the {x,y} position
-    /// considered the current origin of the enemy
-    ////////////////////////////////////////////////////////////
-    const Vector2f getCentre() const override;
+    const float getDistanceFromCentre() const;
 
+private:
     ////////////////////////////////////////////////////////////
-    /// \brief Returns current Movement state for the enemy
+    /// \brief Resets the shooting status of the enemy
     ///
-    /// \return An enum value of the current movement state
+    /// \return Resets the _isShooting member to false
     ////////////////////////////////////////////////////////////
-    const MovementState getMovementState() const override;
+    void stopShoot();
 
     ////////////////////////////////////////////////////////////
-    /// \brief Returns the currently set movement direction for the enemy
+    /// \brief Sets the origin of the enemy's circle, and the cached distance
+    /// of that origin from the centre of the screen
     ///
-    /// \return An enum value of the current movement direction,
-    /// clockwise or counterclockwise
+    /// \param centre The offset of the circle's origin from the centre of the screen
     ////////////////////////////////////////////////////////////
-    const int getMovementDirectionSign() const override;
+    void setCentre(Vector2f centre);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Returns amount of time since the enemy last shot a bullet
-    ///
-    /// \return A float value (in seconds) of the amount of elapsed time
+    /// \brief The random stream used when the enemy respawns
+    /// \see reset
     ////////////////////////////////////////////////////////////
-    const float getShootTimerElapsedTime() const override;
+    Random _random;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Returns the amount of time that the enemy has been alive for.
-    ///
-    /// \return A float value (in seconds) of the time the enemy object has been alive.
+    /// \brief The length of _centre (the distance of the circle's origin from
+    /// the centre of the screen), updated when _centre changes
+    /// \see getDistanceFromCentre
     ////////////////////////////////////////////////////////////
-    const float getAliveTimeElapsedTime() const override;
+    float _centreDistance;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Returns the shooting status of the enemy
-    ///
-    /// \return If true, then the enemy is shooting on this frame
+    /// \brief The number of simulation steps since the enemy last shot
+    /// (counted in update)
+    /// \see getShootTimerElapsedTime
     ////////////////////////////////////////////////////////////
-    const bool isShooting() const override;
+    SimulationClock::Ticks _ticksSinceShot;
 
-private:
     ////////////////////////////////////////////////////////////
-    /// \brief Resets the shooting status of the enemy
-    ///
-    /// \return Resets the _isShooting member to false
+    /// \brief The number of simulation steps since the enemy was created
+    /// (counted in update)
+    /// \see getAliveTimeElapsedTime
     ////////////////////////////////////////////////////////////
-    void stopShoot() override;
-
+    SimulationClock::Ticks _ticksAlive;
 };
 
 #endif //PROJECT_ENEMYSHIP_HPP
\ No newline at end of file
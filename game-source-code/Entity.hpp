@@ -11,20 +11,24 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <cmath>
+#include <cassert>
 #include "common.hpp"
+#include "FastMath.hpp"
 #include "Moveable.hpp"
 #include "Animatable.hpp"
 
 using sf::Vector2f;
 using sf::Vector2i;
-using sf::Sprite;
-using sf::IntRect;
-using sf::Clock;
 
 ////////////////////////////////////////////////////////////
 /// \brief Entity Class, inherited from Animatable and Moveable
 ///
-/// An abstract base class for game objects
+/// The base class for game objects, holding the state and getters they share.
+/// It has no virtual functions: each entity class is final and defines its
+/// own move(), update(), reset() and die(), and every container holds one
+/// concrete type by value, so all calls are resolved (and can be inlined) at
+/// compile time. Code that works on any entity is a template over the entity
+/// type, rather than taking an Entity reference
 ///
 /// \see Moveable
 /// \see Animatable
@@ -41,7 +45,7 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief The Entity class constructor
     /// Calls the Moveable and Animatable constructors,
-    /// and sets the resolution
+    /// sets the resolution, and places the entity at its starting position
     ///
     /// \param resolution The screen resolution of the game
     /// \param distanceFromCentre The radius from centre of an entity
@@ -49,114 +53,270 @@ public:
     /// \param scale The scale of the entity
     /// \param type An enum that identifies the entity type. Defined in common.hpp,
     /// passed to the Animatable base class
-    /// \param textureHolder The resourceMapper object that
-    /// contains the path to the texture(s) for the entity's sprite
     ///
     /// \see Moveable
     /// \see Animatable
     /// \see common
-    /// \see ResourceHolder
     ////////////////////////////////////////////////////////////
     Entity(const Vector2i resolution,
            float distanceFromCentre,
            float angle,
            float scale,
-           const entity::ID type,
-           const TextureHolder &textureHolder) : Moveable{distanceFromCentre,
-                                                          angle,
-                                                          scale},
-                                                 Animatable{textureHolder,
-                                                            type},
-                                                 _resolution{resolution},
-                                                 _lives{0},
-                                                 _isAlive{true},
-                                                 _isShooting{false} {}
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Pure virtual method definition for returning the
-    /// remaining number of lives of the entity
+           const entity::ID type) : Moveable{distanceFromCentre,
+                                             angle,
+                                             scale},
+                                    Animatable{type},
+                                    _resolution{resolution},
+                                    _lives{0},
+                                    _isAlive{true},
+                                    _isShooting{false},
+                                    _collisionRadius{0}
+    {
+        setPolarPosition(distanceFromCentre, angle);
+        storePreviousState();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the remaining number of lives of the entity
+    ///
     /// \returns An integer value of the number of remaining lives
     /// \see _lives
     ////////////////////////////////////////////////////////////
-    virtual const int getLives() const=0;
+    const int getLives() const
+    {return _lives;}
 
     ////////////////////////////////////////////////////////////
     /// \brief Boolean state of the entity (alive/dead)
     ///
     /// \return A boolean value of alive(1) or dead(0)
     ////////////////////////////////////////////////////////////
-    virtual const bool isAlive() const=0;
+    const bool isAlive() const
+    {return _isAlive;}
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns the shooting status of the entity
     ///
     /// \return If true, then the enemy is shooting on this frame
     ////////////////////////////////////////////////////////////
-    virtual const bool isShooting() const
+    const bool isShooting() const
     {return _isShooting;}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Sets the _isShooting state of the entity
+    /// \brief Returns the entity type
+    ///
+    /// \return An enum value (defined in common.hpp) of the entity type
+    /// \see common
+    /// \see Entity
     ////////////////////////////////////////////////////////////
-    virtual void setShoot(){};
+    const entity::ID getType() const
+    {return _type;}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Resets the object timer, measuring when the entity last shot a bullet
-    ////////////////////////////////////////////////////////////
-    virtual void resetShootTimer(){};
+    /// \brief Returns the distance of the entity from the centre of the screen
+    ///
+    /// \return A float value, the distance from the centre (screen space),
+    /// as of the last move
+    ////////////////////////////////////////////////////////////
+    const float getRadius() const
+    {
+        checkCachedKinematics();
+        return _polarRadius;
+    }
 
     ////////////////////////////////////////////////////////////
-    /// \brief Returns amount of time since the entity last shot a bullet
+    /// \brief Returns the angle of the entity around the centre of the screen
     ///
-    /// \return A float value (in seconds) of the amount of elapsed time
+    /// \return A float value, the angle in degrees, as of the last move
     ////////////////////////////////////////////////////////////
-    virtual const float getShootTimerElapsedTime() const
-    { return _timerShoot.getElapsedTime().asSeconds();}
+    const float getAngle() const
+    {
+        checkCachedKinematics();
+        return _polarAngle;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the size of the entity's bounding box on screen
+    ///
+    /// The current texture frame is scaled and rotated, and the axis-aligned box
+    /// around it is measured. This matches the width and height of
+    /// sf::Sprite::getGlobalBounds() for the sprite drawn by the EntityRenderer
+    ///
+    /// \return A Vector2f - two (float) values {width,height} in screen space
+    /// \see EntityRenderer
+    ////////////////////////////////////////////////////////////
+    const Vector2f getBoundsSize() const
+    {
+        auto width = _rectArea.width * std::fabs(_screenScale.x);
+        auto height = _rectArea.height * std::fabs(_screenScale.y);
+        float sine, cosine;
+        fastmath::sinCosDegrees(_rotation, sine, cosine);
+        sine = std::fabs(sine);
+        cosine = std::fabs(cosine);
+        return {width * cosine + height * sine, width * sine + height * cosine};
+    }
 
     ////////////////////////////////////////////////////////////
-    /// \brief Returns the amount of time that the entity has been alive for.
+    /// \brief Returns the centre of the circle used to approximate the entity for collisions
     ///
-    /// \return A float value (in seconds) of the time the enemy object has been alive.
+    /// \return The entity's screen position, as of its last move or reset
+    /// \see updateCollisionCircle
     ////////////////////////////////////////////////////////////
-    virtual const float getAliveTimeElapsedTime() const
-    {return _timerAlive.getElapsedTime().asSeconds();}
+    const Vector2f getCollisionCentre() const
+    {return _collisionCentre;}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Returns the entity type
+    /// \brief Returns the radius of the circle used to approximate the entity for collisions
     ///
-    /// \return An enum value (defined in common.hpp) of the entity type
-    /// \see common
-    /// \see Entity
+    /// \return The radius in screen space, as of the entity's last move or reset
+    /// \see updateCollisionCircle
+    /// \see EntityController::collides
     ////////////////////////////////////////////////////////////
-    virtual const entity::ID  getType() const=0;
+    const float getCollisionRadius() const
+    {return _collisionRadius;}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Pure virtual method definition for performing an update on the entity object
+    /// \brief Returns the distance of the entity from the centre of the screen,
+    /// as a fraction of the radius of the play area (half the screen height)
+    ///
+    /// \return 0 at the centre, 1 at the edge of the play area, at any resolution
     ////////////////////////////////////////////////////////////
-    virtual void update()=0;
+    const float getNormalisedRadius() const
+    {return _polarRadius / (_resolution.y / 2.f);}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Pure virtual method definition for resetting the entity to a default state
+    /// \brief Stores the current position, scale and rotation as the previous
+    /// state, for render interpolation
+    ///
+    /// Called at the start of every simulation step, and after a reset (so that
+    /// an entity jumping back to its start is not drawn sliding there)
+    ///
+    /// \see getInterpolatedPosition
+    ////////////////////////////////////////////////////////////
+    void storePreviousState()
+    {
+        _previousPosition = _position;
+        _previousScale = _screenScale;
+        _previousRotation = _rotation;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the screen position between the previous and current step
+    ///
+    /// \param interpolation How far from the previous (0) to the current (1) state
+    /// \return A Vector2f - two (float) values {x,y} of the screen space coordinates
     ////////////////////////////////////////////////////////////
-    virtual void reset()=0;
+    const Vector2f getInterpolatedPosition(float interpolation) const
+    {return _previousPosition + (_position - _previousPosition) * interpolation;}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Pure virtual method definition for decrementing an entity's lives count
+    /// \brief Returns the scale between the previous and current step
+    ///
+    /// \param interpolation How far from the previous (0) to the current (1) state
+    /// \return A Vector2f - two (float) values {x,y} of the scale in width and height
     ////////////////////////////////////////////////////////////
-    virtual void die()=0;
+    const Vector2f getInterpolatedScale(float interpolation) const
+    {return _previousScale + (_screenScale - _previousScale) * interpolation;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the rotation between the previous and current step,
+    /// turning the short way round
+    ///
+    /// \param interpolation How far from the previous (0) to the current (1) state
+    /// \return The rotation in degrees
+    ////////////////////////////////////////////////////////////
+    const float getInterpolatedRotation(float interpolation) const
+    {
+        auto turn = fastmath::wrapDegrees(_rotation - _previousRotation + 180) - 180;
+        return _previousRotation + turn * interpolation;
+    }
 
 protected:
     ////////////////////////////////////////////////////////////
-    /// \brief Resets the shooting status of the entity
+    /// \brief Places the entity at a distance and angle from the centre of the screen
     ///
-    /// \return Resets the _isShooting member to false
+    /// The polar position is stored as given, and the screen position is
+    /// calculated from it
+    ///
+    /// \param radius The distance from the centre of the screen (screen space)
+    /// \param angle The angle in degrees (0 points down the screen, increasing anticlockwise)
+    ////////////////////////////////////////////////////////////
+    void setPolarPosition(float radius, float angle)
+    {
+        _polarRadius = radius;
+        _polarAngle = angle;
+        float sine, cosine;
+        fastmath::sinCosDegrees(angle, sine, cosine);
+        _position = {radius * sine + _resolution.x / 2,
+                     radius * cosine + _resolution.y / 2};
+    }
+
     ////////////////////////////////////////////////////////////
-    virtual void stopShoot(){};
+    /// \brief Places the entity at a screen position, and calculates its polar position
+    ///
+    /// Needs a sqrt and atan2, so is only used where the entity is not moving
+    /// around the centre of the screen (off-screen resets, offset circles)
+    ///
+    /// \param position The screen coordinate {x,y}
+    ////////////////////////////////////////////////////////////
+    void setScreenPosition(Vector2f position)
+    {
+        _position = position;
+        auto x = position.x - _resolution.x / 2;
+        auto y = position.y - _resolution.y / 2;
+        _polarRadius = std::sqrt((x * x) + (y * y));
+        _polarAngle = fastmath::wrapDegrees(fastmath::atan2Degrees(x, y));
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recalculates the bounds and collision circle from the current position,
+    /// scale and rotation
+    ///
+    /// Called at the end of every move() and reset(), so that the collision
+    /// checks and getDistanceFromCentre only read the stored values. The radius
+    /// is the sum of the bounds' width and height, shrunk by a factor of 4.2
+    /// (slightly smaller than the average half-size, so that corners do not collide)
+    ///
+    /// \see getBoundsSize
+    ////////////////////////////////////////////////////////////
+    void updateCollisionCircle()
+    {
+        auto shrink_factor = 4 + 0.2f;
+        _boundsSize = getBoundsSize();
+        _collisionCentre = _position;
+        _collisionRadius = (_boundsSize.x + _boundsSize.y) / shrink_factor;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Checks that the cached polar position and bounds match the values
+    /// recalculated from the screen position, scale and rotation
+    ///
+    /// Called by the getters that return cached values. Only compiled in
+    /// when GYRUSS_CHECK_CACHE is defined (the CMake option of the same
+    /// name), as the recalculation costs more than the caching saves
+    ////////////////////////////////////////////////////////////
+    void checkCachedKinematics() const
+    {
+#ifdef GYRUSS_CHECK_CACHE
+        auto x = _position.x - _resolution.x / 2;
+        auto y = _position.y - _resolution.y / 2;
+        auto radius = std::sqrt((x * x) + (y * y));
+        assert(std::fabs(std::fabs(_polarRadius) - radius) <= 0.01f + radius * 1e-4f);
+        if (radius > 1)
+        {
+            auto angle = _polarRadius < 0 ? _polarAngle + 180 : _polarAngle;
+            auto difference = fastmath::wrapDegrees(angle - common::radToDegree(std::atan2(x, y)) + 180) - 180;
+            assert(std::fabs(difference) <= 0.05f);
+        }
+        auto bounds = getBoundsSize();
+        assert(std::fabs(_boundsSize.x - bounds.x) <= 1e-3f + bounds.x * 1e-5f);
+        assert(std::fabs(_boundsSize.y - bounds.y) <= 1e-3f + bounds.y * 1e-5f);
+#endif
+    }
 
     ////////////////////////////////////////////////////////////
-    /// \brief The game resolution in {x,y}
+    /// \brief The game resolution in {x,y}. Not const, so entities can be stored by value
     ////////////////////////////////////////////////////////////
-    const Vector2i _resolution;
+    Vector2i _resolution;
 
     ////////////////////////////////////////////////////////////
     /// \brief The number of lives remaining of an entity
@@ -175,16 +335,40 @@ protected:
     bool _isShooting;
 
     ////////////////////////////////////////////////////////////
-    /// \param A timer since last bullet shooting occurred
-    /// \see getShootTimerElapsedTime
+    /// \param The size of the bounding box on screen, as of the last move or reset
+    /// \see getBoundsSize
+    ////////////////////////////////////////////////////////////
+    Vector2f _boundsSize;
+
+    ////////////////////////////////////////////////////////////
+    /// \param The centre of the collision circle
+    /// \see getCollisionCentre
+    ////////////////////////////////////////////////////////////
+    Vector2f _collisionCentre;
+
+    ////////////////////////////////////////////////////////////
+    /// \param The radius of the collision circle
+    /// \see getCollisionRadius
+    ////////////////////////////////////////////////////////////
+    float _collisionRadius;
+
+    ////////////////////////////////////////////////////////////
+    /// \param The screen position at the start of the current step
+    /// \see storePreviousState
+    ////////////////////////////////////////////////////////////
+    Vector2f _previousPosition;
+
+    ////////////////////////////////////////////////////////////
+    /// \param The scale at the start of the current step
+    /// \see storePreviousState
     ////////////////////////////////////////////////////////////
-    Clock _timerShoot;
+    Vector2f _previousScale;
 
     ////////////////////////////////////////////////////////////
-    /// \param A timer measuring how long the entity has been alive
-    /// \see getAliveTimeElapsedTime
+    /// \param The rotation at the start of the current step
+    /// \see storePreviousState
     ////////////////////////////////////////////////////////////
-    Clock _timerAlive;
+    float _previousRotation;
 
 };
 
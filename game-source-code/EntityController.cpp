@@ -6,21 +6,32 @@
 
 EntityController::EntityController(Vector2i resolution,
                                    PlayerShip &playerShip,
-                                   TextureHolder &textureHolder,
                                    Score &score,
-                                   float speedModifier) : _resolution{resolution},
-                                                          _playerShip{playerShip},
-                                                          _textureHolder{textureHolder},
-                                                          _score{score}
-{
-    // Reset timers for the enemy spawning and shooting
+                                   const SimulationClock &clock,
+                                   float speedModifier,
+                                   Random random) : _resolution{resolution},
+                                                    _playerShip{playerShip},
+                                                    _bulletsEnemy{128},
+                                                    _bulletsPlayer{64},
+                                                    _explosions{64},
+                                                    _meteoroids{16},
+                                                    _timerSpawnFromPerimeter{clock},
+                                                    _timerSpawnFromCentre{clock},
+                                                    _timerSpawnWanderer{clock},
+                                                    _timerSatellite{clock},
+                                                    _timerMeteoroid{clock},
+                                                    _totalTime{clock},
+                                                    _score{score},
+                                                    _random{random},
+                                                    _entityStreams{0},
+                                                    _enemyGrid{{resolution.x / 2.f, resolution.y / 2.f}, resolution.y / 2.f},
+                                                    _meteoroidGrid{{resolution.x / 2.f, resolution.y / 2.f}, resolution.y / 2.f},
+                                                    _jobs{nullptr},
+                                                    _parallelThreshold{0}
+{
+    // The timers for the enemy spawning start from the clock's current tick
     _satellitesAlive = 0;
-    _timerSpawnFromCentre.restart();
-    _timerSpawnFromPerimeter.restart();
-    _timerSpawnWanderer.restart();
-    _timerSatellite.restart();
-    _timerMeteoroid.restart();
-    _totalTime.restart();
+    _nextStressShooter = 0;
 
     _explosionHasOccurred = false;
     _defaultSpeed = speedModifier;
@@ -36,6 +47,66 @@ EntityController::EntityController(Vector2i resolution,
     _yNoise = PerlinNoise(seed1);
 }
 
+void EntityController::setJobSystem(JobSystem *jobs, std::size_t parallelThreshold)
+{
+    _jobs = jobs;
+    _parallelThreshold = parallelThreshold;
+}
+
+void EntityController::setStressMode(const StressSettings &settings)
+{
+    _stress = settings;
+    _enemies.reserve(settings.enemies);
+    if (settings.bullets > _bulletsEnemy.capacity())
+        _bulletsEnemy = bulletList{settings.bullets};
+}
+
+template <typename Function>
+void EntityController::forEachIndex(std::size_t count, Function function)
+{
+    if (_jobs == nullptr || count < _parallelThreshold)
+    {
+        for (auto i = std::size_t{0}; i < count; i++)
+            function(i);
+        return;
+    }
+
+    // Past the threshold, every thread gets an equal share
+    _jobs->parallelFor(count, 1, [&function](std::size_t begin, std::size_t end)
+    {
+        for (auto i = begin; i < end; i++)
+            function(i);
+    });
+}
+
+template <typename Predicate>
+int EntityController::findCollision(const PolarGrid &grid, const Entity &entity, Predicate isTarget) const
+{
+    // One list of runs per thread, kept to reuse its memory
+    thread_local std::vector<PolarGrid::range> ranges;
+    grid.queryRanges(entity.getCollisionCentre(), entity.getCollisionRadius(), ranges);
+    const auto &circles = grid.getSortedCircles();
+    for (const auto &run : ranges)
+    {
+        for (auto first = run.begin; first < run.end; first += collision::batchSize)
+        {
+            auto hits = collision::overlapMask(entity.getCollisionCentre(),
+                                               entity.getCollisionRadius(),
+                                               circles,
+                                               first,
+                                               run.end - first);
+            for (auto bit = 0u; hits != 0; bit++, hits >>= 1)
+            {
+                if (!(hits & 1u))
+                    continue;
+                auto index = grid.getSortedIndex(first + bit);
+                if (isTarget(index))
+                    return static_cast<int>(index);
+            }
+        }
+    }
+    return -1;
+}
 
 void EntityController::spawnBasicEnemy(entity::ID id,
                                        textures::ID shipVariant,
@@ -65,8 +136,8 @@ void EntityController::spawnBasicEnemy(entity::ID id,
 
         case (MovementState::Wandering):
         {
-            spiralDistanceFromCentre = (_resolution.y / 3) - rand() % 10; // Slightly random position to start wandering
-            spiralAngle = _playerShip.getAngle() + rand() % 90 + 180; // Random angle, avoiding playerShip
+            spiralDistanceFromCentre = (_resolution.y / 3) - _random.nextInt(10); // Slightly random position to start wandering
+            spiralAngle = _playerShip.getAngle() + _random.nextInt(90) + 180; // Random angle, avoiding playerShip
             _timerSpawnWanderer.restart();
             break;
         }
@@ -75,40 +146,43 @@ void EntityController::spawnBasicEnemy(entity::ID id,
             break;
     }
 
-    auto enemy = std::make_unique<Enemy>(_resolution,
-                                         spiralDistanceFromCentre,
-                                         spiralAngle,
-                                         0.5,
-                                         id,
-                                         _textureHolder,
-                                         shipVariant,
-                                         movementState,
-                                         movementDirection);
+    Enemy enemy(_resolution,
+                spiralDistanceFromCentre,
+                spiralAngle,
+                0.5,
+                id,
+                shipVariant,
+                movementState,
+                movementDirection,
+                entityStream());
 
     // SpiralIn and Wandering need to have their move set on spawn to prevent clipping. SpiralOut does not
     // need this as it is in the centre to begin with.
     if((movementState==MovementState::Wandering)||(movementState==MovementState::SpiralIn))
     {
-        enemy->setScale(0, 0);
-        enemy->setMove(0, 0);
-        enemy->move();
+        enemy.setScale(0, 0);
+        enemy.setMove(0, 0);
+        enemy.move();
     }
-    _enemies.push_front(std::move(enemy)); // Add enemy to enemy vector
+    _enemies.push_back(std::move(enemy)); // Add enemy to enemy vector
 }
 
 
+Random EntityController::entityStream()
+{
+    return _random.substream(_entityStreams++);
+}
+
 void EntityController::spawnMeteoroid()
 {
     _timerMeteoroid.restart();
-    auto randomAngle = rand()%360;
-    auto meteoroid = std::make_unique<Meteoroid>(_resolution,
-                                                 0,
-                                                 randomAngle,
-                                                 1,
-                                                 entity::Meteoroid,
-                                                 _textureHolder,
-                                                 textures::Meteoroid);
-    _meteoroids.push_front(std::move(meteoroid));
+    auto randomAngle = _random.nextInt(360);
+    _meteoroids.spawn(_resolution,
+                      0,
+                      randomAngle,
+                      1,
+                      entity::Meteoroid,
+                      textures::Meteoroid);
 
 }
 
@@ -119,7 +193,7 @@ void EntityController::spawnSatellites()
     _satellitesAlive = numberOfSatellites + 1; // Only ever want 3 alive at a time (index starts at 1)
     auto satelliteCirclingRadius = _resolution.y / 20;
     auto satelliteSpawnScale = 0.7;
-    auto movementDirection = static_cast<MovementDirection>(rand() % 2); // Random clockwise or counter-clockwise
+    auto movementDirection = static_cast<MovementDirection>(_random.nextInt(2)); // Random clockwise or counter-clockwise
     auto angle = 0;
     auto currentShipRadius = _playerShip.getRadius(); // Current playership location is used for satellite spawn
     auto currentShipAngle = _playerShip.getAngle();
@@ -131,62 +205,68 @@ void EntityController::spawnSatellites()
     for (auto i = 0; i < numberOfSatellites; i++) //need to spawn 3 Satellites. run loop 3 times
     {
         //introduce a random element on spawn and add to the generic centre the others use
-        auto randomOffsetX = rand() % 20 + 10.0f;
-        auto randomOffsetY = rand() % 20 + 10.0f;
+        auto randomOffsetX = _random.nextInt(20) + 10.0f;
+        auto randomOffsetY = _random.nextInt(20) + 10.0f;
 
         //spawn ships at a slight random offset from centre of rotation point
         satelliteSpawnLocation={satelliteSpawnLocation.x+randomOffsetX,satelliteSpawnLocation.y+randomOffsetY};
-        auto enemy = std::make_unique<Enemy>(_resolution,
-                                             satelliteCirclingRadius,
-                                             angle,
-                                             satelliteSpawnScale,
-                                             entity::Satellite,
-                                             _textureHolder,
-                                             textures::Satellite,
-                                             MovementState::SmallCircling,
-                                             movementDirection);
+        Enemy enemy(_resolution,
+                    satelliteCirclingRadius,
+                    angle,
+                    satelliteSpawnScale,
+                    entity::Satellite,
+                    textures::Satellite,
+                    MovementState::SmallCircling,
+                    movementDirection,
+                    entityStream());
 
         angle += 120; // Symmetric spawning
-        enemy->setScale(0,0);
-        enemy->setMove(0,0,satelliteSpawnLocation); // Ensure  satellite not off-screen
-        enemy->move();
-        _enemies.push_front(std::move(enemy));
+        enemy.setScale(0,0);
+        enemy.setMove(0,0,satelliteSpawnLocation); // Ensure  satellite not off-screen
+        enemy.move();
+        _enemies.push_back(std::move(enemy));
     }
 }
 
 void EntityController::spawnEntities()
 {
+    if (_stress.isEnabled())
+    {
+        spawnStressPopulation();
+        return;
+    }
+
     // Initial delay before first enemies spawn
-    if (_totalTime.getElapsedTime().asSeconds() > 1)
+    if (_totalTime.getElapsedTime() > 1)
     {
         auto minNumberEnemies = 1;
         auto maxNumberEnemies = 8;
         if (_enemies.size() < maxNumberEnemies)
         {
-            auto shipVariant = static_cast<textures::ID>(rand() % 2);
+            auto shipVariant = static_cast<textures::ID>(_random.nextInt(2));
             auto shipType = static_cast<entity::ID>(shipVariant);
-            auto movementDirection = static_cast<MovementDirection>(rand() % 2);
+            auto movementDirection = static_cast<MovementDirection>(_random.nextInt(2));
 
             // Spawn enemy spiral out
-            float enemySpawnFromCentreTimer = float(fmod(rand(), 1.2f) + 0.8f);
-            if ((_timerSpawnFromCentre.getElapsedTime().asSeconds() > enemySpawnFromCentreTimer)
+            float enemySpawnFromCentreTimer = _random.nextFloat(0.8f, 2.f);
+            if ((_timerSpawnFromCentre.getElapsedTime() > enemySpawnFromCentreTimer)
                 || (_enemies.size() <= minNumberEnemies))
             {
                 spawnBasicEnemy(shipType, shipVariant, movementDirection, MovementState::SpiralOut);
             }
 
             // Spawn enemy spiral in
-            float enemySpawnFromPerimeterTimer = float(fmod(rand(), 2.4f) + 1.6f);
-            if ((_timerSpawnFromPerimeter.getElapsedTime().asSeconds() > enemySpawnFromPerimeterTimer)
+            float enemySpawnFromPerimeterTimer = _random.nextFloat(1.6f, 4.f);
+            if ((_timerSpawnFromPerimeter.getElapsedTime() > enemySpawnFromPerimeterTimer)
                 || (_enemies.size() <= minNumberEnemies))
             {
                 spawnBasicEnemy(shipType, shipVariant, movementDirection, MovementState::SpiralIn);
             }
 
             // Spawn enemy wanderer
-            float enemySpawnWandererTimer = float(fmod(rand(), 3.4f) + 2.6f);
+            float enemySpawnWandererTimer = _random.nextFloat(2.6f, 6.f);
 
-            if ((_timerSpawnWanderer.getElapsedTime().asSeconds() > enemySpawnWandererTimer)
+            if ((_timerSpawnWanderer.getElapsedTime() > enemySpawnWandererTimer)
                 || (_enemies.size() <= minNumberEnemies))
             {
                 spawnBasicEnemy(entity::BasicWanderer, textures::EnemyShipYellow, movementDirection, MovementState::Wandering);
@@ -196,8 +276,8 @@ void EntityController::spawnEntities()
         // Spawn satellites
         if (_satellitesAlive == 0)
         {
-            float satelliteSpawn = float(fmod(rand(), 5.f) + 15.f);
-            if (_timerSatellite.getElapsedTime().asSeconds() > satelliteSpawn)
+            float satelliteSpawn = _random.nextFloat(15.f, 20.f);
+            if (_timerSatellite.getElapsedTime() > satelliteSpawn)
                 spawnSatellites();
         }
         else
@@ -205,12 +285,33 @@ void EntityController::spawnEntities()
             _timerSatellite.restart();
         }
         // Spawn meteoroids
-        auto meteoroidSpawnEventTimer = fmod(rand(),8.f) + 10.f;
-        if (_timerMeteoroid.getElapsedTime().asSeconds() > meteoroidSpawnEventTimer)
+        auto meteoroidSpawnEventTimer = _random.nextFloat(10.f, 18.f);
+        if (_timerMeteoroid.getElapsedTime() > meteoroidSpawnEventTimer)
             spawnMeteoroid();
     }
 }
 
+void EntityController::spawnStressPopulation()
+{
+    const MovementState movementStates[] = {MovementState::SpiralOut,
+                                            MovementState::SpiralIn,
+                                            MovementState::Wandering};
+    while (_enemies.size() < _stress.enemies)
+    {
+        auto movementDirection = static_cast<MovementDirection>(_random.nextInt(2));
+        auto movementState = movementStates[_random.nextInt(3)];
+        if (movementState == MovementState::Wandering)
+        {
+            spawnBasicEnemy(entity::BasicWanderer, textures::EnemyShipYellow, movementDirection, movementState);
+        }
+        else
+        {
+            auto shipVariant = static_cast<textures::ID>(_random.nextInt(2));
+            spawnBasicEnemy(static_cast<entity::ID>(shipVariant), shipVariant, movementDirection, movementState);
+        }
+    }
+}
+
 void EntityController::playerShoot()
 {
     auto numberOfBullets = 1;
@@ -229,16 +330,13 @@ void EntityController::playerShoot()
         else
             bulletOffset *= -1;
 
-        auto bullet = std::make_unique<Bullet>(_resolution,
-                                               _playerShip.getDistanceFromCentre(),
-                                               _playerShip.getAngle() + bulletOffset,
-                                               bulletScale,
-                                               entity::PlayerBullet,
-                                               _textureHolder,
-                                               textures::BulletPlayer);
-
-        _bulletsPlayer.push_front(std::move(bullet));
-        _score.incrementBulletsFired();
+        if (_bulletsPlayer.spawn(_resolution,
+                                 _playerShip.getDistanceFromCentre(),
+                                 _playerShip.getAngle() + bulletOffset,
+                                 bulletScale,
+                                 entity::PlayerBullet,
+                                 textures::BulletPlayer))
+            _score.incrementBulletsFired();
     }
 }
 
@@ -247,29 +345,40 @@ void EntityController::enemyShoot()
     _enemyShootEventHasOccurred = false;
     auto minNumberEnemyBullets = 0; //rand() % 2;
     auto doNotFireInsideThisRadius = (_resolution.y / 2) * 0.05; // Only shoot when closer (5% of circle radius)
-    float enemyShootTime = float(fmod(rand(),2.5f) + 3.2f);
+    float enemyShootTime = _random.nextFloat(3.2f, 5.7f);
     for (auto &enemy : _enemies)    // All enemies need a chance to shoot
     {
-        if (enemy->getDistanceFromCentre() > doNotFireInsideThisRadius)
+        if (enemy.getDistanceFromCentre() > doNotFireInsideThisRadius)
         {
-            if ((enemy->getShootTimerElapsedTime() > enemyShootTime)
+            if ((enemy.getShootTimerElapsedTime() > enemyShootTime)
                 || (_bulletsEnemy.size() < minNumberEnemyBullets))
             {
-                enemy->resetShootTimer();
-                enemy->setShoot();
-                auto bullet_enemy = std::make_unique<Bullet>(_resolution,
-                                                             enemy->getRadius(),
-                                                             enemy->getAngle(),
-                                                             0.3,
-                                                             entity::EnemyBullet,
-                                                             _textureHolder,
-                                                             textures::BulletEnemy);
-
-                _bulletsEnemy.push_front(move(bullet_enemy));
+                enemy.resetShootTimer();
+                enemy.setShoot();
+                _bulletsEnemy.spawn(_resolution,
+                                    enemy.getRadius(),
+                                    enemy.getAngle(),
+                                    0.3,
+                                    entity::EnemyBullet,
+                                    textures::BulletEnemy);
+
                 _enemyShootEventHasOccurred = true;
             }
         }
     }
+
+    // Stress mode: the enemies take turns to fire until the bullets are topped up
+    while (!_enemies.empty() && _bulletsEnemy.size() < _stress.bullets)
+    {
+        const auto &enemy = _enemies[_nextStressShooter++ % _enemies.size()];
+        if (!_bulletsEnemy.spawn(_resolution,
+                                 enemy.getRadius(),
+                                 enemy.getAngle(),
+                                 0.3,
+                                 entity::EnemyBullet,
+                                 textures::BulletEnemy))
+            break;
+    }
 }
 
 void EntityController::shoot()
@@ -293,21 +402,27 @@ void EntityController::setEnemyMoveState()
     auto shipClipScreenZone = _resolution.y/2.5f; // Prevents change in behaviour near boundary
     auto minimumRadius = (_resolution.y/2)*0.06; // Specifies minimum radius that within no behaviour changes occur
 
-    for (auto &enemy : _enemies)
+    // Each enemy draws from its own substream of this frame's stream, so the
+    // enemies can be moved on any thread, in any order, with the same result
+    auto frameStream = entityStream();
+    forEachIndex(_enemies.size(), [&](std::size_t i)
     {
+        auto &enemy = _enemies[i];
+        auto random = frameStream.substream(i);
+
         // Generic properties for each enemy. defined in the loop as per enemy specific
-        auto currentEnemyMovementState = enemy->getMovementState();
-        auto currentEnemyRadius = enemy->getRadius();
-        auto currentEnemyType = enemy->getType();
+        auto currentEnemyMovementState = enemy.getMovementState();
+        auto currentEnemyRadius = enemy.getRadius();
+        auto currentEnemyType = enemy.getType();
         if ((currentEnemyRadius > _resolution.y / 2.f)  // Don't leave game play area, re-spawn in centre after leaving
              || ((currentEnemyMovementState == MovementState::SpiralIn) && (currentEnemyRadius < minimumRadius))) // Reset from spiral inwards
         {
-            enemy->reset();
+            enemy.reset();
         }
         else
         {
             // Random values to define ship movement
-            auto randomStateChange = rand()%100+1; // 1 to 100%, chance to change state
+            auto randomStateChange = random.nextInt(100) + 1; // 1 to 100%, chance to change state
 
             // Chance that the ship will enter a new movement state
             if (((currentEnemyType  == entity::Basic) || (currentEnemyType  == entity::BasicAlternate)) // Only apply changes to normal ships
@@ -317,44 +432,45 @@ void EntityController::setEnemyMoveState()
 
                 if (randomStateChange < 6)                                          // 5% chance
                 {
-                    enemy->setMovementState(MovementState::CircleOffsetLeft);
+                    enemy.setMovementState(MovementState::CircleOffsetLeft);
                 }
                 if (randomStateChange > 6 && randomStateChange < 13)                // 5% chance
                 {
-                    enemy->setMovementState(MovementState::CircleOffsetRight);
+                    enemy.setMovementState(MovementState::CircleOffsetRight);
                 } else if ((randomStateChange > 50) && (randomStateChange < 52))    // 2% chance
                 {
-                    enemy->setMovementState(MovementState::SpiralIn);
+                    enemy.setMovementState(MovementState::SpiralIn);
                 } else if (randomStateChange == 60)                                 // 1% change
                 {
-                    enemy->setMovementState(MovementState::SpiralOut);
+                    enemy.setMovementState(MovementState::SpiralOut);
                 }
             }
-            setEnemyMove(enemy, currentEnemyMovementState, growShipScreenZone, currentEnemyRadius);
+            setEnemyMove(enemy, currentEnemyMovementState, growShipScreenZone, currentEnemyRadius, random);
         }
-    }
+    });
 }
 
-void EntityController::setEnemyMove(std::unique_ptr<Entity> &enemy,
+void EntityController::setEnemyMove(Enemy &enemy,
                                     MovementState currentEnemyMovementState,
                                     float growShipScreenZone,
-                                    float currentEnemyRadius)
+                                    float currentEnemyRadius,
+                                    Random &random) const
 {
 
     auto shipCircleRadius = _resolution.y / 3.f;    // Size of spiral side circle radius
-    auto shipOffsetIncrement = rand() % 3 + 1.f;    // How circle offset changes
-    auto shipRadiusIncrease = rand() % 3 + 1.f;     // How much to increment the ship radius by
+    auto shipOffsetIncrement = random.nextInt(3) + 1.f;    // How circle offset changes
+    auto shipRadiusIncrease = random.nextInt(3) + 1.f;    // How much to increment the ship radius by
     auto distantSpeedMultiplier = 10.f;             // How fast the ship circles grow in the small region of the screen
     auto satelliteGrowIncrement = 2.0f;             // Satellites grow at a different rate, faster than other entities
-    auto randomAngle = rand() % 2 + 2.0f;           // Constantly increasing random angle of rotation
+    auto randomAngle = random.nextInt(2) + 2.0f;    // Constantly increasing random angle of rotation
     auto perlinNoiseAngleOffset = 5.0f;             // Size of angle offset used in perlinNoise movement
     auto perlinNoiseSpeedScale = 3.0f;             // Scales speed of perlinNoise
     auto perlinRadiusOffset = 70.0f;                // Change in radius for perlinNoise
 
 
-    auto currentEnemyDirectionSign = enemy->getMovementDirectionSign();
-    auto currentEnemyTimeAlive = enemy->getAliveTimeElapsedTime();
-    auto currentEnemyCentre = enemy->getCentre();
+    auto currentEnemyDirectionSign = enemy.getMovementDirectionSign();
+    auto currentEnemyTimeAlive = enemy.getAliveTimeElapsedTime();
+    auto currentEnemyCentre = enemy.getCentre();
 
 
     // Movement (based on behaviour state)
@@ -364,12 +480,12 @@ void EntityController::setEnemyMove(std::unique_ptr<Entity> &enemy,
         {
             if (currentEnemyRadius < growShipScreenZone) // Grow faster if close to the centre
             {
-                enemy->setMove(randomAngle * _speedModifier,
+                enemy.setMove(randomAngle * _speedModifier,
                                shipRadiusIncrease * distantSpeedMultiplier * _speedModifier,
                                currentEnemyCentre);
             }
             else
-                enemy->setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
+                enemy.setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
                                shipRadiusIncrease * _speedModifier,
                                currentEnemyCentre);
             break;
@@ -377,7 +493,7 @@ void EntityController::setEnemyMove(std::unique_ptr<Entity> &enemy,
 
         case (MovementState::SpiralIn) : // Spiral in movement. decrement the radius
         {
-            enemy->setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
+            enemy.setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
                            -shipRadiusIncrease * _speedModifier,
                            currentEnemyCentre);
             break;
@@ -387,13 +503,13 @@ void EntityController::setEnemyMove(std::unique_ptr<Entity> &enemy,
         {
             if (currentEnemyCentre.x < shipCircleRadius)
             {
-                enemy->setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
+                enemy.setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
                                0,
                                {currentEnemyCentre.x + shipOffsetIncrement, currentEnemyCentre.y});
             }
             else
             {
-                enemy->setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
+                enemy.setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
                                +shipRadiusIncrease * _speedModifier,
                                currentEnemyCentre);
             }
@@ -404,13 +520,13 @@ void EntityController::setEnemyMove(std::unique_ptr<Entity> &enemy,
         {
             if (currentEnemyCentre.x > -shipCircleRadius)
             {
-                enemy->setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
+                enemy.setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
                                0,
                                {currentEnemyCentre.x - shipOffsetIncrement, currentEnemyCentre.y});
             }
             else
             {
-                enemy->setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
+                enemy.setMove(randomAngle * currentEnemyDirectionSign * _speedModifier,
                                +shipRadiusIncrease * _speedModifier,
                                currentEnemyCentre);
             }
@@ -419,7 +535,7 @@ void EntityController::setEnemyMove(std::unique_ptr<Entity> &enemy,
 
         case (MovementState::SmallCircling) : // Small circle movement, used for satellites
         {
-            enemy->setMove(randomAngle * _speedModifier,
+            enemy.setMove(randomAngle * _speedModifier,
                            satelliteGrowIncrement,
                            currentEnemyCentre);
             break;
@@ -433,7 +549,7 @@ void EntityController::setEnemyMove(std::unique_ptr<Entity> &enemy,
             auto perlinY = float((_yNoise.noise(currentEnemyTimeAlive / perlinNoiseSpeedScale) * perlinRadiusOffset -
                                   perlinRadiusOffset / 2));
 
-            enemy->setMove(perlinX * currentEnemyDirectionSign * _speedModifier,
+            enemy.setMove(perlinX * currentEnemyDirectionSign * _speedModifier,
                            perlinY * _speedModifier,
                            {0, 0});
             break;
@@ -443,23 +559,23 @@ void EntityController::setEnemyMove(std::unique_ptr<Entity> &enemy,
 
 void EntityController::setBulletMove()
 {
-    for (auto &bullet : _bulletsPlayer)
+    forEachIndex(_bulletsPlayer.size(), [this](std::size_t i)
     {
-        bullet->setMove(-_bulletPlayerSpeed);
-    }
+        _bulletsPlayer[i].setMove(-_bulletPlayerSpeed);
+    });
 
-    for (auto &bullet : _bulletsEnemy)
+    forEachIndex(_bulletsEnemy.size(), [this](std::size_t i)
     {
-        bullet->setMove(_bulletEnemySpeed * _speedModifier);
-    }
+        _bulletsEnemy[i].setMove(_bulletEnemySpeed * _speedModifier);
+    });
 }
 
 void EntityController::setMeteoroidMove()
 {
-    for (auto &meteoroid : _meteoroids)
+    forEachIndex(_meteoroids.size(), [this](std::size_t i)
     {
-        meteoroid->setMove(_meteoroidSpeed * _speedModifier);
-    }
+        _meteoroids[i].setMove(_meteoroidSpeed * _speedModifier);
+    });
 }
 
 void EntityController::setMove()
@@ -471,32 +587,36 @@ void EntityController::setMove()
 
 void EntityController::update()
 {
-    for (auto &enemy : _enemies)
-        enemy->update();
+    forEachIndex(_enemies.size(), [this](std::size_t i) {_enemies[i].update();});
 
-    for (auto &bullet : _bulletsPlayer)
-    {
-        bullet->update();
-    }
+    forEachIndex(_bulletsPlayer.size(), [this](std::size_t i) {_bulletsPlayer[i].update();});
 
-    for (auto &bullet : _bulletsEnemy)
-    {
-        bullet->update();
-    }
+    forEachIndex(_bulletsEnemy.size(), [this](std::size_t i) {_bulletsEnemy[i].update();});
 
-    for (auto &meteoroid : _meteoroids)
-    {
-        meteoroid->update();
-    }
+    forEachIndex(_meteoroids.size(), [this](std::size_t i) {_meteoroids[i].update();});
 
-    for (auto &explosion : _explosions)
-        explosion->update();
+    forEachIndex(_explosions.size(), [this](std::size_t i) {_explosions[i].update();});
 
     // Reset shoot and explosion events
     _explosionHasOccurred = false;
     _enemyShootEventHasOccurred = false;
 }
 
+void EntityController::storePreviousStates()
+{
+    _playerShip.storePreviousState();
+
+    forEachIndex(_enemies.size(), [this](std::size_t i) {_enemies[i].storePreviousState();});
+
+    forEachIndex(_bulletsPlayer.size(), [this](std::size_t i) {_bulletsPlayer[i].storePreviousState();});
+
+    forEachIndex(_bulletsEnemy.size(), [this](std::size_t i) {_bulletsEnemy[i].storePreviousState();});
+
+    forEachIndex(_meteoroids.size(), [this](std::size_t i) {_meteoroids[i].storePreviousState();});
+
+    forEachIndex(_explosions.size(), [this](std::size_t i) {_explosions[i].storePreviousState();});
+}
+
 bool EntityController::checkCollisions()
 {
     _explosionHasOccurred = false;
@@ -513,95 +633,146 @@ bool EntityController::checkCollisions()
 
 void EntityController::checkPlayerBulletsToEnemyCollisions()
 {
+    // Broad-phase: bucket the enemies by ring and sector, so each bullet is only tested against nearby enemies
+    _enemyGrid.clear();
+    for (auto i = 0u; i < _enemies.size(); i++)
+        _enemyGrid.insert(i, _enemies[i].getCollisionCentre(), _enemies[i].getCollisionRadius());
+    _enemyGrid.build();
+
+    // Query the grid for every bullet first (the queries are independent, so
+    // may run on several threads), then resolve the hits in order
+    auto isAlive = [this](std::size_t index) {return _enemies[index].getLives() > 0;};
+    _collisionHits.resize(_bulletsPlayer.size());
+    forEachIndex(_bulletsPlayer.size(), [this, &isAlive](std::size_t i)
+    {
+        _collisionHits[i] = findCollision(_enemyGrid, _bulletsPlayer[i], isAlive);
+    });
+
     // PlayerBullets -> Enemy (enemy explodes, PlayerBullet disappears)
-    for (auto enemy = _enemies.begin(); enemy != _enemies.end(); ++enemy)
+    // Removing swaps the last bullet into the slot, so its hit is swapped with it
+    for (auto i = 0u; i < _bulletsPlayer.size();)
     {
-        for (auto bullet = _bulletsPlayer.begin(); bullet != _bulletsPlayer.end();)
+        auto index = _collisionHits[i];
+        if (index < 0)
         {
-            if (collides((*bullet)->getSprite(), (*enemy)->getSprite()))
-            {
-                auto explosion = std::make_unique<Explosion>(_resolution,
-                                                             (*enemy)->getRadius(),
-                                                             (*enemy)->getAngle(),
-                                                             (*enemy)->getScale().x * 2,
-                                                             entity::Explosion,
-                                                             _textureHolder,
-                                                             textures::Explosion);
-                _explosions.push_back(std::move(explosion));
-                bullet = _bulletsPlayer.erase(bullet);
-                (*enemy)->die();
-                _score.incrementEnemiesKilled((*enemy)->getType());
-                enemyKilled((*enemy)->getType());
-                _explosionHasOccurred = true;
-            }
-            else
-                bullet++;
+            i++;
+            continue;
         }
-    }
 
-    // Process Enemy death events from PlayerBullets collisions above
-    // (indexing/incrementing problems prevent performing these actions in the same nested loop)
-    for (auto enemy = _enemies.begin(); enemy != _enemies.end();)
-    {
-        if ((*enemy)->getLives() == 0)
+        auto &enemy = _enemies[index];
+        if (!isAlive(index))
         {
-            enemy = _enemies.erase(enemy);
+            // An earlier bullet killed this enemy, which has moved away but is
+            // still in the grid, so look again among the living
+            _collisionHits[i] = findCollision(_enemyGrid, _bulletsPlayer[i], isAlive);
+            continue;
         }
-        else
-            enemy++;
+
+        _explosions.spawn(_resolution,
+                          enemy.getRadius(),
+                          enemy.getAngle(),
+                          enemy.getScale().x * 2,
+                          entity::Explosion,
+                          textures::Explosion,
+                          entityStream());
+        enemy.die();
+        _score.incrementEnemiesKilled(enemy.getType());
+        enemyKilled(enemy.getType());
+        _explosionHasOccurred = true;
+        _bulletsPlayer.erase(_bulletsPlayer.begin() + i);
+        _collisionHits[i] = _collisionHits.back();
+        _collisionHits.pop_back();
     }
+
+    // Process Enemy death events from PlayerBullets collisions above
+    // (removing them inside the loop would invalidate the grid's indices)
+    _enemies.erase(std::remove_if(_enemies.begin(), _enemies.end(),
+                                  [](const Enemy &enemy) {return enemy.getLives() <= 0;}),
+                   _enemies.end());
 }
 
 void EntityController::checkPlayerBulletsToMeteoroidCollisions()
 {
-    // PlayerBullets -> Enemy (enemy explodes, PlayerBullet disappears)
-    for (auto meteoroid = _meteoroids.begin(); meteoroid != _meteoroids.end(); ++meteoroid)
+    _meteoroidGrid.clear();
+    for (auto i = 0u; i < _meteoroids.size(); i++)
+        _meteoroidGrid.insert(i, _meteoroids[i].getCollisionCentre(), _meteoroids[i].getCollisionRadius());
+    _meteoroidGrid.build();
+
+    auto isAlive = [this](std::size_t index) {return _meteoroids[index].getLives() > 0;};
+    _collisionHits.resize(_bulletsPlayer.size());
+    forEachIndex(_bulletsPlayer.size(), [this, &isAlive](std::size_t i)
+    {
+        _collisionHits[i] = findCollision(_meteoroidGrid, _bulletsPlayer[i], isAlive);
+    });
+
+    // PlayerBullets -> Meteoroid (bullet explodes and disappears, meteoroid keeps going)
+    for (auto i = 0u; i < _bulletsPlayer.size();)
     {
-        for (auto bullet = _bulletsPlayer.begin(); bullet != _bulletsPlayer.end();)
+        auto index = _collisionHits[i];
+        if (index < 0)
         {
-            if (collides((*bullet)->getSprite(), (*meteoroid)->getSprite()))
-            {
-                auto explosion = std::make_unique<Explosion>(_resolution,
-                                                             (*bullet)->getRadius(),
-                                                             (*bullet)->getAngle(),
-                                                             (*bullet)->getScale().x / 2,
-                                                             entity::Explosion,
-                                                             _textureHolder,
-                                                             textures::Explosion);
-                _explosions.push_back(std::move(explosion));
-                bullet = _bulletsPlayer.erase(bullet);
-                _explosionHasOccurred = true;
-            }
-            else
-                bullet++;
+            i++;
+            continue;
+        }
+        if (!isAlive(index))
+        {
+            _collisionHits[i] = findCollision(_meteoroidGrid, _bulletsPlayer[i], isAlive);
+            continue;
         }
+
+        const auto &bullet = _bulletsPlayer[i];
+        _explosions.spawn(_resolution,
+                          bullet.getRadius(),
+                          bullet.getAngle(),
+                          bullet.getScale().x / 2,
+                          entity::Explosion,
+                          textures::Explosion,
+                          entityStream());
+        _explosionHasOccurred = true;
+        _bulletsPlayer.erase(_bulletsPlayer.begin() + i);
+        _collisionHits[i] = _collisionHits.back();
+        _collisionHits.pop_back();
     }
 }
+
 void EntityController::checkEnemyBulletsToPlayerShipCollisions()
 {
+    // Test the playerShip against the enemy bullets a batch at a time
+    _collisionCircles.clear();
+    for (const auto &bullet : _bulletsEnemy)
+        _collisionCircles.push_back(bullet.getCollisionCentre(), bullet.getCollisionRadius());
+
+    _collisionCandidates.clear();
+    for (auto first = 0u; first < _collisionCircles.size(); first += collision::batchSize)
+    {
+        auto hits = collision::overlapMask(_playerShip.getCollisionCentre(),
+                                           _playerShip.getCollisionRadius(),
+                                           _collisionCircles,
+                                           first,
+                                           _collisionCircles.size() - first);
+        for (auto bit = 0u; hits != 0; bit++, hits >>= 1)
+            if (hits & 1)
+                _collisionCandidates.push_back(first + bit);
+    }
+
     // EnemyBullets -> PlayerShip (player explodes + dies, bullet disappears)
-    for (auto bullet = _bulletsEnemy.begin(); bullet != _bulletsEnemy.end();)
+    // Removing swaps the last bullet into the slot, so remove from the back
+    // to keep the remaining hit indices valid
+    for (auto hit = _collisionCandidates.rbegin(); hit != _collisionCandidates.rend(); hit++)
     {
-        if (collides(_playerShip.getSprite(), (*bullet)->getSprite()))
+        _explosions.spawn(_resolution,
+                          _playerShip.getDistanceFromCentre(),
+                          _playerShip.getAngle(),
+                          _playerShip.getScale().x * 2,
+                          entity::Explosion,
+                          textures::Explosion,
+                          entityStream());
+        _bulletsEnemy.erase(_bulletsEnemy.begin() + *hit);
+        if (!_playerShip.isInvulnerable())
         {
-            auto explosion = std::make_unique<Explosion>(_resolution,
-                                                         _playerShip.getDistanceFromCentre(),
-                                                         _playerShip.getAngle(),
-                                                         _playerShip.getScale().x * 2,
-                                                         entity::Explosion,
-                                                         _textureHolder,
-                                                         textures::Explosion);
-            _explosions.push_back(std::move(explosion));
-            bullet = _bulletsEnemy.erase(bullet);
-            if (!_playerShip.isInvulnerable())
-            {
-                _playerHasBeenHit = true;
-            }
-            _explosionHasOccurred = true;
+            _playerHasBeenHit = true;
         }
-        else
-            bullet++;
-
+        _explosionHasOccurred = true;
     }
 }
 
@@ -610,16 +781,15 @@ void EntityController::checkMeteoroidToPlayerShipCollisions()
     // Meteoroids -> PlayerShip (player explodes + dies, meteor keeps going)
     for (auto meteoroid = _meteoroids.begin(); meteoroid != _meteoroids.end(); meteoroid++)
     {
-        if (collides(_playerShip.getSprite(), (*meteoroid)->getSprite()))
+        if (collides(_playerShip, *meteoroid))
         {
-            auto explosion = std::make_unique<Explosion>(_resolution,
-                                                         _playerShip.getDistanceFromCentre(),
-                                                         _playerShip.getAngle(),
-                                                         (*meteoroid)->getScale().x,
-                                                         entity::Explosion,
-                                                         _textureHolder,
-                                                         textures::Explosion);
-            _explosions.push_back(std::move(explosion));
+            _explosions.spawn(_resolution,
+                              _playerShip.getDistanceFromCentre(),
+                              _playerShip.getAngle(),
+                              meteoroid->getScale().x,
+                              entity::Explosion,
+                              textures::Explosion,
+                              entityStream());
             if (!_playerShip.isInvulnerable())
             {
                 _playerHasBeenHit = true;
@@ -634,18 +804,17 @@ void EntityController::checkEnemyToPlayerShipCollisions()
     // Enemy <-> PlayerShip (enemy explodes, player dies)
     for (auto enemy = _enemies.begin(); enemy != _enemies.end();)
     {
-        if (collides(_playerShip.getSprite(), (*enemy)->getSprite()))
+        if (collides(_playerShip, *enemy))
         {
-            auto explosion = std::make_unique<Explosion>(_resolution,
-                                                         _playerShip.getDistanceFromCentre(),
-                                                         _playerShip.getAngle(),
-                                                         (*enemy)->getScale().x * 2,
-                                                         entity::Explosion,
-                                                         _textureHolder,
-                                                         textures::Explosion);
-            _explosions.push_back(move(explosion));
-//            _score.incrementEnemiesKilled((*enemy)->getType());
-            enemyKilled((*enemy)->getType());
+            _explosions.spawn(_resolution,
+                              _playerShip.getDistanceFromCentre(),
+                              _playerShip.getAngle(),
+                              enemy->getScale().x * 2,
+                              entity::Explosion,
+                              textures::Explosion,
+                              entityStream());
+//            _score.incrementEnemiesKilled(enemy->getType());
+            enemyKilled(enemy->getType());
             enemy = _enemies.erase(enemy);
             if (!_playerShip.isInvulnerable())
             {
@@ -666,108 +835,84 @@ const bool EntityController::explosionOccurred()
 void EntityController::checkClipping()
 {
     // Clip away projectiles (bullets/meteoroids) outside cylindrical frustum at playerShip Camera plane
-    for (auto bullet = _bulletsEnemy.begin(); bullet != _bulletsEnemy.end();)
-    {
-        if ((*bullet)->getRadius() > _resolution.y / 2)
-        {
-            bullet = _bulletsEnemy.erase(bullet);
-        }
-        else
-            bullet++;
-    }
-
-    for (auto meteoroid = _meteoroids.begin(); meteoroid != _meteoroids.end();)
-    {
-        if ((*meteoroid)->getRadius() > _resolution.y / 2)
-        {
-            meteoroid = _meteoroids.erase(meteoroid);
-        }
-        else
-            meteoroid++;
-    }
+    auto outsideFrustum = [](const Entity &entity) {return entity.getNormalisedRadius() > 1;};
+    _bulletsEnemy.removeIf(outsideFrustum);
+    _meteoroids.removeIf(outsideFrustum);
 
     // Clip away player bullets at centre
     auto radius_buffer = 20;
-    for (auto bullet = _bulletsPlayer.begin(); bullet != _bulletsPlayer.end();)
+    _bulletsPlayer.removeIf([this, radius_buffer](const Bullet &bullet)
     {
-        if (((*bullet)->getPosition().x > (_resolution.x / 2) - radius_buffer)
-            && ((*bullet)->getPosition().y > (_resolution.y / 2) - radius_buffer)
-            && ((*bullet)->getPosition().x < (_resolution.x / 2) + radius_buffer)
-            && ((*bullet)->getPosition().y < (_resolution.y / 2) + radius_buffer))
-        {
-            bullet = _bulletsPlayer.erase(bullet);
-        }
-        else
-            bullet++;
-    }
+        return (bullet.getPosition().x > (_resolution.x / 2) - radius_buffer)
+               && (bullet.getPosition().y > (_resolution.y / 2) - radius_buffer)
+               && (bullet.getPosition().x < (_resolution.x / 2) + radius_buffer)
+               && (bullet.getPosition().y < (_resolution.y / 2) + radius_buffer);
+    });
 
     // Remove any finished explosions
-    for (auto explosion = _explosions.begin(); explosion != _explosions.end();)
-    {
-        if ((*explosion)->getLives() == 0)
-        {
-            explosion = _explosions.erase(explosion);
-        }
-        else
-            explosion++;
-    }
+    _explosions.removeIf([](const Explosion &explosion) {return explosion.getLives() == 0;});
 }
 
-bool EntityController::collides(const Sprite &sprite1, const Sprite &sprite2)
+bool EntityController::collides(const Entity &entity1, const Entity &entity2)
 {
-    auto shrink_factor = 4 + 0.2f;
-    float radius_1 = (sprite1.getGlobalBounds().width + sprite1.getGlobalBounds().height) / shrink_factor;
-    float radius_2 = (sprite2.getGlobalBounds().width + sprite2.getGlobalBounds().height) / shrink_factor;
-    float distance_x = sprite1.getPosition().x - sprite2.getPosition().x;
-    float distance_y = sprite1.getPosition().y - sprite2.getPosition().y;
+    auto reach = entity1.getCollisionRadius() + entity2.getCollisionRadius();
+    auto distance = entity1.getCollisionCentre() - entity2.getCollisionCentre();
 
-    return radius_1 + radius_2 >= sqrt((distance_x * distance_x) + (distance_y * distance_y));
+    // Compare squared lengths, no sqrt needed
+    return reach * reach >= (distance.x * distance.x) + (distance.y * distance.y);
 }
 
 void EntityController::killAllEnemiesOfType(entity::ID type)
 {
-    for (auto enemy = _enemies.begin(); enemy != _enemies.end();)
+    for (const auto &enemy : _enemies)
     {
-        auto enemyType = (*enemy)->getType();
-        if (enemyType == entity::Satellite)
+        if (enemy.getType() == entity::Satellite)
         {
             _satellitesAlive = 0;
         }
-
-        if (enemyType == type)
-        {
-            enemy = _enemies.erase(enemy);
-        }
-        else
-            enemy++;
     }
+    _enemies.erase(std::remove_if(_enemies.begin(), _enemies.end(),
+                                  [type](const Enemy &enemy) {return enemy.getType() == type;}),
+                   _enemies.end());
 }
 
-const entityList& EntityController::getBulletsPlayer() const
+const bulletList& EntityController::getBulletsPlayer() const
 {
     return _bulletsPlayer;
 }
 
-const entityList& EntityController::getBulletsEnemy() const
+const bulletList& EntityController::getBulletsEnemy() const
 {
     return _bulletsEnemy;
 }
 
-const entityList& EntityController::getEnemies() const
+const enemyList& EntityController::getEnemies() const
 {
     return _enemies;
 }
 
-const entityList& EntityController::getMeteoroids() const
+const meteoroidList& EntityController::getMeteoroids() const
 {
     return _meteoroids;
 }
 
-const entityList& EntityController::getExplosions() const
+const explosionList& EntityController::getExplosions() const
 {
     return _explosions;
 }
 
+void EntityController::reportPoolUsage(std::ostream &output) const
+{
+    auto report = [&output](const char *name, std::size_t highWaterMark, std::size_t capacity, std::size_t overflows)
+    {
+        output << name << ": " << highWaterMark << "/" << capacity << " (" << overflows << " refused)\n";
+    };
+    report("Player bullets", _bulletsPlayer.highWaterMark(), _bulletsPlayer.capacity(), _bulletsPlayer.overflows());
+    report("Enemy bullets", _bulletsEnemy.highWaterMark(), _bulletsEnemy.capacity(), _bulletsEnemy.overflows());
+    report("Meteoroids", _meteoroids.highWaterMark(), _meteoroids.capacity(), _meteoroids.overflows());
+    report("Explosions", _explosions.highWaterMark(), _explosions.capacity(), _explosions.overflows());
+}
+
 void EntityController::changeGlobalSpeed(float amount = 0.1f)
 {
     auto minimumSpeed = 0.1f;
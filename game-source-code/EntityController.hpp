@@ -6,9 +6,10 @@
 #ifndef PROJECT_ENTITYCONTROLLER_HPP
 #define PROJECT_ENTITYCONTROLLER_HPP
 
-#include <list>
+#include <vector>
+#include <algorithm>
+#include <ostream>
 #include "common.hpp"
-#include "ResourceHolder.hpp"
 #include "Entity.hpp"
 #include "PlayerShip.hpp"
 #include "Enemy.hpp"
@@ -17,8 +18,27 @@
 #include "Meteoroid.hpp"
 #include "Score.hpp"
 #include "PerlinNoise.hpp"
+#include "Random.hpp"
+#include "SimulationClock.hpp"
+#include "EntityPool.hpp"
+#include "PolarGrid.hpp"
+#include "CollisionKernel.hpp"
+#include "JobSystem.hpp"
+#include "StressSettings.hpp"
 
-using entityList = std::list<std::unique_ptr<Entity>>;
+////////////////////////////////////////////////////////////
+/// \brief Contiguous storage for each kind of entity
+///
+/// Entities are stored by value, so the per-frame loops walk linearly through
+/// memory and call the (final) entity methods directly, instead of following
+/// a list node and a unique_ptr to each object and dispatching virtually.
+/// The short-lived bullets, meteoroids and explosions live in fixed-capacity
+/// pools, so a running game does not allocate when spawning them
+////////////////////////////////////////////////////////////
+using enemyList = std::vector<Enemy>;
+using bulletList = EntityPool<Bullet>;
+using meteoroidList = EntityPool<Meteoroid>;
+using explosionList = EntityPool<Explosion>;
 
 ////////////////////////////////////////////////////////////
 /// \brief EntityController Class
@@ -40,20 +60,22 @@ public:
     ///
     /// \param resolution The Screen resolution of the game
     /// \param playerShip The playerShip, generated from the game.cpp. needed for collision detection
-    /// \param textures used to create new entities that require this class for creation
     /// \param score object to track the current game score, enemies killed and player deaths. created in game.cpp
+    /// \param clock The game's simulation clock, which times the spawn events (must outlive the EntityController)
     /// \param speedModifier defines how fast the game runs at a particular time to speed up game as time progresses
+    /// \param random The random stream for this game. Spawned enemies and explosions get their own substreams
     ///
     /// \see [SFML/Vector2](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Vector2.php)
     /// \see PlayerShip
     /// \see Score
-    /// \see ResourceHolder
+    /// \see SimulationClock
     ///////////////////////////////////////////////////////////////
     EntityController(Vector2i resolution,
                      PlayerShip &playerShip,
-                     TextureHolder &textures,
                      Score &score,
-                     float speedModifier);
+                     const SimulationClock &clock,
+                     float speedModifier,
+                     Random random = Random{});
 
     ////////////////////////////////////////////////////////////
     /// \brief Sets up next frame' movement on all entities (in EntityController)
@@ -116,6 +138,15 @@ public:
     ////////////////////////////////////////////////////////////
     void spawnSatellites();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Spawns enemies until there are as many as stress mode asks for,
+    /// with random movement states (spiral out, spiral in and wandering).
+    /// Called from spawnEntities instead of the normal spawning
+    ///
+    /// \see setStressMode
+    ////////////////////////////////////////////////////////////
+    void spawnStressPopulation();
+
     ////////////////////////////////////////////////////////////
     /// \brief Initiates a player shoot event based on current gun level
     /// and adds a bullet to the bulletList
@@ -146,18 +177,21 @@ public:
     bool checkCollisions();
 
     ////////////////////////////////////////////////////////////
-    /// \brief Used to check for collisions between two sprites
+    /// \brief Used to check for collisions between two entities
+    ///
+    /// Each entity is approximated by the collision circle stored on its last move,
+    /// sized from its on-screen bounds
     ///
-    /// \param sprite1 first sprite that is fed in, compared to sprite2
-    /// \param sprite2 second sprite that is fed in, compared to sprite1
+    /// \param entity1 first entity that is fed in, compared to entity2
+    /// \param entity2 second entity that is fed in, compared to entity1
     ///
     /// \see checkCollision
-    /// \see [SFML/Sprite](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Sprite.php)
+    /// \see Entity::getCollisionRadius
     ///
     /// \return a bool, true if collision, false if not
     ////////////////////////////////////////////////////////////
-    bool collides(const Sprite &sprite1,
-                  const Sprite &sprite2);
+    bool collides(const Entity &entity1,
+                  const Entity &entity2);
 
     ////////////////////////////////////////////////////////////
     /// \brief Updates all game objects by calling the underlying update functions.
@@ -165,6 +199,15 @@ public:
     ////////////////////////////////////////////////////////////
     void update();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Stores the current state of every entity (and the playerShip) as its
+    /// previous state. Called at the start of every simulation step, so that
+    /// frames drawn between steps can interpolate between the two
+    ///
+    /// \see Entity::storePreviousState
+    ////////////////////////////////////////////////////////////
+    void storePreviousStates();
+
     ////////////////////////////////////////////////////////////
     /// \brief Getter to return if an explosion has occurred on the current frame.
     /// Used to deal with multiple explosions occurred in quick succession to reset
@@ -217,16 +260,14 @@ public:
     ///
     /// \return List of all player bullets currently in play
     ////////////////////////////////////////////////////////////
-//    const bulletList &getBulletsPlayer() const;
-    const entityList &getBulletsPlayer() const;
+    const bulletList &getBulletsPlayer() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns a list of all current enemy bullets.
     ///
     /// \return List of all enemy bullets
     ////////////////////////////////////////////////////////////
-//    const bulletList &getBulletsEnemy() const;
-    const entityList &getBulletsEnemy() const;
+    const bulletList &getBulletsEnemy() const;
 
 
     ////////////////////////////////////////////////////////////
@@ -234,26 +275,73 @@ public:
     ///
     /// \return List of all enemies currently in play
     ////////////////////////////////////////////////////////////
-//    const enemyList &getEnemies() const;
-    const entityList &getEnemies() const;
+    const enemyList &getEnemies() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns a list of all current meteoroid.
     ///
     /// \return List of current meteoroids in play
     ////////////////////////////////////////////////////////////
-//    const meteoroidList &getMeteoroids() const;
-    const entityList &getMeteoroids() const;
+    const meteoroidList &getMeteoroids() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns a list of all current explosions.
     ///
     /// \return List of current explosions in play
     ////////////////////////////////////////////////////////////
-//    const explosionList &getExplosions() const;
-    const entityList &getExplosions() const;
+    const explosionList &getExplosions() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Writes the capacity, high-water mark and number of refused spawns
+    /// of each entity pool, used to tune the pool capacities
+    ///
+    /// \param output The stream to write the report to
+    ///
+    /// \see EntityPool
+    ////////////////////////////////////////////////////////////
+    void reportPoolUsage(std::ostream &output) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Spreads the per-entity loops (movement, update and the
+    /// player bullet collision queries) across a job system's threads
+    ///
+    /// A loop over fewer entities than the threshold is not worth the
+    /// hand-off, and stays on the calling thread. Each enemy draws its
+    /// movement from its own random stream, so a game plays out the same
+    /// whether or not it is spread across threads.
+    ///
+    /// \param jobs The job system to use, or nullptr to run every loop on the calling thread
+    /// \param parallelThreshold The fewest entities in a loop worth spreading across threads
+    ///
+    /// \see JobSystem::parallelFor
+    ////////////////////////////////////////////////////////////
+    void setJobSystem(JobSystem *jobs, std::size_t parallelThreshold = 256);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replaces the normal spawning with stress mode, which keeps the
+    /// enemies and enemy bullets topped up to the given populations
+    ///
+    /// Grows the enemy bullet pool to hold them. Called before the first step
+    ///
+    /// \param settings The populations to keep up
+    ///
+    /// \see spawnStressPopulation
+    ////////////////////////////////////////////////////////////
+    void setStressMode(const StressSettings &settings);
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Calls function(i) for every index i below count, across the
+    /// job system's threads if there is one and count reaches the threshold
+    ///
+    /// \param count The number of entities in the loop
+    /// \param function The loop body. It may only change the i'th entity
+    ///
+    /// \see setJobSystem
+    ////////////////////////////////////////////////////////////
+    template <typename Function>
+    void forEachIndex(std::size_t count, Function function);
+
     ////////////////////////////////////////////////////////////
     /// \brief Changes enemy movement state based on current ship position and
     /// random chance to change flight pattern
@@ -272,14 +360,16 @@ private:
     /// \param currentEnemyMovementState movement state that the ship should preform operation in. be it spiral in or others
     /// \param growShipScreenZone defines region where the ship should grow and not change state
     /// \param currentEnemyRadius defines the current size of the enemy ship
+    /// \param random the enemy's random stream for this frame
     ///
     /// \see setMove
     /// \see Enemy
     ////////////////////////////////////////////////////////////
-    void setEnemyMove(std::unique_ptr<Entity> &enemy,
+    void setEnemyMove(Enemy &enemy,
                       MovementState currentEnemyMovementState,
                       float growShipScreenZone,
-                      float currentEnemyRadius);
+                      float currentEnemyRadius,
+                      Random &random) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Sets the next frame's movement on all bullets (Player and Enemy)
@@ -334,6 +424,26 @@ private:
     ////////////////////////////////////////////////////////////
     void checkPlayerBulletsToMeteoroidCollisions();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Finds an entity in a grid whose collision circle overlaps an entity's.
+    /// The grid's candidates are tested a batch at a time. Safe to call
+    /// from several threads at once
+    ///
+    /// The grid is not updated as entities die, so isTarget(index) tells
+    /// which of its entities can still be hit
+    ///
+    /// \param grid The built grid of the entities to test against
+    /// \param entity The entity to test (e.g. a player bullet)
+    /// \param isTarget Returns true if the entity at an index can be hit
+    ///
+    /// \see collision::overlapMask
+    ///
+    /// \return The index of the overlapping entity in its owner's array,
+    /// or -1 if there is none
+    ////////////////////////////////////////////////////////////
+    template <typename Predicate>
+    int findCollision(const PolarGrid &grid, const Entity &entity, Predicate isTarget) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Used when any enemy is killed to preform additional enemy type
     /// spesific logic, such as upgrading a gun kf all satellites are killed
@@ -352,12 +462,6 @@ private:
     ////////////////////////////////////////////////////////////
     Vector2i _resolution;
 
-    ////////////////////////////////////////////////////////////
-    /// \brief Texture holder, to access all game assets loaded in other context.
-    /// Is a reference as is not created in the EntityController
-    ////////////////////////////////////////////////////////////
-    TextureHolder &_textureHolder;
-
     ////////////////////////////////////////////////////////////
     /// \brief PlayerShip object generated from game.cpp. Is a reference
     /// as is not created in the EntityController
@@ -366,62 +470,62 @@ private:
 
 
     ////////////////////////////////////////////////////////////
-    /// \brief A list of unique_ptr of type <Entity> to store all Enemy Bullets
+    /// \brief Stores all Enemy Bullets
     ////////////////////////////////////////////////////////////
-    entityList _bulletsEnemy;
+    bulletList _bulletsEnemy;
 
     ////////////////////////////////////////////////////////////
-    /// \brief A list of unique_ptr of type <Entity> to store all Player Bullets
+    /// \brief Stores all Player Bullets
     ////////////////////////////////////////////////////////////
-    entityList _bulletsPlayer;
+    bulletList _bulletsPlayer;
 
     ////////////////////////////////////////////////////////////
-    /// \brief A list of unique_ptr of type <Entity> to store all Enemy ships
+    /// \brief Stores all Enemy ships
     ////////////////////////////////////////////////////////////
-    entityList _enemies;
+    enemyList _enemies;
 
     ////////////////////////////////////////////////////////////
-    /// \brief A list of unique_ptr of type <Entity> to store current explosion objects
+    /// \brief Stores current explosion objects
     ////////////////////////////////////////////////////////////
-    entityList _explosions;
+    explosionList _explosions;
 
     ////////////////////////////////////////////////////////////
-    /// \brief A list of unique_ptr of type <Entity> to store flying meteoroids
+    /// \brief Stores flying meteoroids
     ////////////////////////////////////////////////////////////
-    entityList _meteoroids;
+    meteoroidList _meteoroids;
 
     ////////////////////////////////////////////////////////////
-    /// \brief A Clock to store time from last ship spawn from perimeter. Used to stagger
+    /// \brief A timer to store game time from last ship spawn from perimeter. Used to stagger
     /// the spawn event of a ship flying with this formation
     ////////////////////////////////////////////////////////////
-    Clock _timerSpawnFromPerimeter;
+    TickTimer _timerSpawnFromPerimeter;
 
     ////////////////////////////////////////////////////////////
-    /// \brief A Clock to store time from last ship spawn from centre. Used to stagger
+    /// \brief A timer to store game time from last ship spawn from centre. Used to stagger
     /// the spawn event of a ship flying with this formation
     ////////////////////////////////////////////////////////////
-    Clock _timerSpawnFromCentre;
+    TickTimer _timerSpawnFromCentre;
 
     ////////////////////////////////////////////////////////////
-    /// \brief A Clock to store time from last wandering ship. Used to stagger
+    /// \brief A timer to store game time from last wandering ship. Used to stagger
     /// the spawn event of a ship flying with this formation
     ////////////////////////////////////////////////////////////
-    Clock _timerSpawnWanderer;
+    TickTimer _timerSpawnWanderer;
 
     ////////////////////////////////////////////////////////////
-    /// \brief A clock to store the time from when a Satellite was las spawned
+    /// \brief A timer to store the game time from when a Satellite was las spawned
     ////////////////////////////////////////////////////////////
-    sf::Clock _timerSatellite;
+    TickTimer _timerSatellite;
 
     ////////////////////////////////////////////////////////////
-    /// \brief A clock to store the time from when a meteoroid was las spawned
+    /// \brief A timer to store the game time from when a meteoroid was las spawned
     ////////////////////////////////////////////////////////////
-    sf::Clock _timerMeteoroid;
+    TickTimer _timerMeteoroid;
 
     ////////////////////////////////////////////////////////////
-    /// \brief A clock to how long the game as been running
+    /// \brief A timer to how long the game as been running (in game time)
     ////////////////////////////////////////////////////////////
-    sf::Clock _totalTime;
+    TickTimer _totalTime;
 
     ////////////////////////////////////////////////////////////
     /// \brief A score object to store the current game score state. This is fed into
@@ -475,6 +579,16 @@ private:
     ////////////////////////////////////////////////////////////
     int _satellitesAlive;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief The populations kept up in stress mode (all zero in normal play)
+    ////////////////////////////////////////////////////////////
+    StressSettings _stress;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The enemy that fires the next extra bullet in stress mode
+    ////////////////////////////////////////////////////////////
+    std::size_t _nextStressShooter;
+
     ////////////////////////////////////////////////////////////
     /// \brief Float to store the speed that a player bullet should fly at
     ////////////////////////////////////////////////////////////
@@ -504,6 +618,70 @@ private:
     ////////////////////////////////////////////////////////////
     PerlinNoise _yNoise;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief The random stream for all spawn and movement decisions
+    ////////////////////////////////////////////////////////////
+    Random _random;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counts the entities given a random substream
+    ///
+    /// \see entityStream
+    ////////////////////////////////////////////////////////////
+    std::uint64_t _entityStreams;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns a new, independent random stream for a spawned entity
+    ///
+    /// \return The next substream of _random
+    ////////////////////////////////////////////////////////////
+    Random entityStream();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Spatial index of the enemies, rebuilt each frame for the
+    /// PlayerBullet -> Enemy collision checks
+    ///
+    /// \see checkPlayerBulletsToEnemyCollisions
+    ////////////////////////////////////////////////////////////
+    PolarGrid _enemyGrid;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Spatial index of the meteoroids, rebuilt each frame for the
+    /// PlayerBullet -> Meteoroid collision checks
+    ///
+    /// \see checkPlayerBulletsToMeteoroidCollisions
+    ////////////////////////////////////////////////////////////
+    PolarGrid _meteoroidGrid;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The entity indices hit in a collision check (kept to reuse its memory)
+    ////////////////////////////////////////////////////////////
+    std::vector<unsigned int> _collisionCandidates;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The entity each player bullet hits in a collision check, or -1
+    /// (kept to reuse its memory)
+    ////////////////////////////////////////////////////////////
+    std::vector<int> _collisionHits;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Collision circles gathered into flat arrays for the batched
+    /// test (kept to reuse its memory)
+    ////////////////////////////////////////////////////////////
+    collision::CircleArray _collisionCircles;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The job system the per-entity loops are spread over, if any
+    ///
+    /// \see setJobSystem
+    ////////////////////////////////////////////////////////////
+    JobSystem *_jobs;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The fewest entities in a loop worth spreading across threads
+    ////////////////////////////////////////////////////////////
+    std::size_t _parallelThreshold;
+
     void enemyShoot();
 };
 
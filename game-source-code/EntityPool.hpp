@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Fixed-capacity storage for short-lived game entities
+///
+/// Bullets, explosions and meteoroids are created and destroyed many
+/// times a second. The pool reserves all of its memory up front, so that
+/// spawning and removing them during a frame never touches the heap.
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_ENTITYPOOL_HPP
+#define PROJECT_ENTITYPOOL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <cstddef>
+
+////////////////////////////////////////////////////////////
+/// \brief The EntityPool class
+///
+/// A contiguous array of live entities of one type, with a fixed capacity.
+/// Spawning constructs in place in the reserved memory. Removing moves the
+/// last entity into the freed slot (the order of entities is not kept).
+/// If the pool is full, spawn() does nothing and returns false.
+///
+/// The largest number of entities ever alive at once (the high-water mark)
+/// is recorded, for tuning the capacities.
+///
+/// \see EntityController
+////////////////////////////////////////////////////////////
+template <typename EntityType>
+class EntityPool
+{
+public:
+    using iterator = typename std::vector<EntityType>::iterator;
+    using const_iterator = typename std::vector<EntityType>::const_iterator;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor, reserves memory for all entities
+    ///
+    /// \param capacity The maximum number of entities alive at once
+    ////////////////////////////////////////////////////////////
+    explicit EntityPool(std::size_t capacity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructs a new entity at the end of the pool
+    ///
+    /// \param arguments The arguments for the EntityType constructor
+    /// \return True if the entity was created, false if the pool is full
+    ////////////////////////////////////////////////////////////
+    template <typename... Arguments>
+    bool spawn(Arguments&&... arguments);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Removes an entity, by moving the last entity into its slot
+    ///
+    /// \param position The entity to remove
+    /// \return An iterator to the entity that now occupies the slot
+    /// (or end(), if the last entity was removed)
+    ////////////////////////////////////////////////////////////
+    iterator erase(iterator position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Removes every entity that matches the predicate
+    ///
+    /// \param predicate A callable taking a const EntityType&, returning true for entities to remove
+    ////////////////////////////////////////////////////////////
+    template <typename Predicate>
+    void removeIf(Predicate predicate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Removes all entities
+    ////////////////////////////////////////////////////////////
+    void clear()
+    {_entities.clear();}
+
+    iterator begin()
+    {return _entities.begin();}
+
+    iterator end()
+    {return _entities.end();}
+
+    const_iterator begin() const
+    {return _entities.begin();}
+
+    const_iterator end() const
+    {return _entities.end();}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the entity at an index (indices change when entities are removed)
+    ////////////////////////////////////////////////////////////
+    EntityType &operator[](std::size_t index)
+    {return _entities[index];}
+
+    const EntityType &operator[](std::size_t index) const
+    {return _entities[index];}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the number of live entities
+    ////////////////////////////////////////////////////////////
+    std::size_t size() const
+    {return _entities.size();}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns true if there are no live entities
+    ////////////////////////////////////////////////////////////
+    bool empty() const
+    {return _entities.empty();}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the maximum number of entities alive at once
+    ////////////////////////////////////////////////////////////
+    std::size_t capacity() const
+    {return _capacity;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the largest number of entities that have been alive at once
+    ////////////////////////////////////////////////////////////
+    std::size_t highWaterMark() const
+    {return _highWaterMark;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the number of spawns refused because the pool was full
+    ////////////////////////////////////////////////////////////
+    std::size_t overflows() const
+    {return _overflows;}
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief The live entities. Memory for capacity entities is reserved on
+    /// construction, so the vector never reallocates
+    ////////////////////////////////////////////////////////////
+    std::vector<EntityType> _entities;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The maximum number of live entities
+    ////////////////////////////////////////////////////////////
+    std::size_t _capacity;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The largest number of entities that have been alive at once
+    ////////////////////////////////////////////////////////////
+    std::size_t _highWaterMark;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of spawns refused because the pool was full
+    ////////////////////////////////////////////////////////////
+    std::size_t _overflows;
+};
+
+// Template classes need to be defined inline
+#include "EntityPool.inl"
+
+#endif //PROJECT_ENTITYPOOL_HPP
@@ -0,0 +1,71 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief  Inline template class implementations for EntityPool
+/////////////////////////////////////////////////////////////////////
+
+#include <utility>
+
+////////////////////////////////////////////////////////////
+/// \brief Reserves the memory for the pool
+///
+/// \param capacity The maximum number of entities alive at once
+////////////////////////////////////////////////////////////
+template <typename EntityType>
+EntityPool<EntityType>::EntityPool(std::size_t capacity) : _capacity{capacity},
+                                                          _highWaterMark{0},
+                                                          _overflows{0}
+{
+    _entities.reserve(_capacity);
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Constructs the entity in place, if there is space
+///
+/// \param arguments The arguments for the EntityType constructor
+////////////////////////////////////////////////////////////
+template <typename EntityType>
+template <typename... Arguments>
+bool EntityPool<EntityType>::spawn(Arguments&&... arguments)
+{
+    if (_entities.size() == _capacity)
+    {
+        _overflows++;
+        return false;
+    }
+    _entities.emplace_back(std::forward<Arguments>(arguments)...);
+    if (_entities.size() > _highWaterMark)
+        _highWaterMark = _entities.size();
+    return true;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Swaps the last entity into the removed slot
+///
+/// \param position The entity to remove
+////////////////////////////////////////////////////////////
+template <typename EntityType>
+typename EntityPool<EntityType>::iterator EntityPool<EntityType>::erase(iterator position)
+{
+    auto offset = position - _entities.begin();
+    if (position + 1 != _entities.end())
+        *position = std::move(_entities.back());
+    _entities.pop_back();
+    return _entities.begin() + offset;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Removes the matching entities, one pass through the pool
+///
+/// \param predicate Returns true for the entities to remove
+////////////////////////////////////////////////////////////
+template <typename EntityType>
+template <typename Predicate>
+void EntityPool<EntityType>::removeIf(Predicate predicate)
+{
+    for (auto entity = begin(); entity != end();)
+    {
+        if (predicate(*entity))
+            entity = erase(entity);
+        else
+            entity++;
+    }
+}
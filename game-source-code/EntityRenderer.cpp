@@ -0,0 +1,79 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Render layer for game entities
+/////////////////////////////////////////////////////////////////////
+
+#include "EntityRenderer.hpp"
+
+EntityRenderer::EntityRenderer(const TextureHolder &textureHolder) : _textureHolder{textureHolder},
+                                                                      _simulationCentre{0, 0},
+                                                                      _outputCentre{0, 0},
+                                                                      _outputScale{1},
+                                                                      _interpolation{1},
+                                                                      _isBatching{true},
+                                                                      _drawCalls{0}
+{}
+
+void EntityRenderer::setViewport(Vector2i simulationResolution, sf::Vector2u outputSize)
+{
+    _simulationCentre = {simulationResolution.x / 2.f, simulationResolution.y / 2.f};
+    _outputCentre = {outputSize.x / 2.f, outputSize.y / 2.f};
+    _outputScale = float(outputSize.y) / simulationResolution.y;
+}
+
+const Sprite &EntityRenderer::getSprite(const Entity &entity)
+{
+    return getSprite(SpriteState{entity});
+}
+
+const Sprite &EntityRenderer::getSprite(const SpriteState &state)
+{
+    // The frame is addressed from the top-left of the texture, wherever it is in the atlas
+    auto region = _textureHolder.getRegion(state.texture);
+    auto frame = state.frame;
+    auto colour = state.colour;
+    _sprite.setTexture(*region.texture);
+    _sprite.setTextureRect({region.rect.left + frame.left, region.rect.top + frame.top, frame.width, frame.height});
+    _sprite.setOrigin(frame.width / 2.f, frame.height / 2.f);
+    _sprite.setPosition(_outputCentre + (state.getInterpolatedPosition(_interpolation) - _simulationCentre) * _outputScale);
+    _sprite.setScale(state.getInterpolatedScale(_interpolation) * _outputScale);
+    _sprite.setRotation(state.getInterpolatedRotation(_interpolation));
+    _sprite.setColor(sf::Color(colour.r, colour.g, colour.b, colour.a));
+    return _sprite;
+}
+
+void EntityRenderer::draw(RenderTarget &target, const Entity &entity)
+{
+    target.draw(getSprite(entity));
+}
+
+void EntityRenderer::addToBatch(const SpriteState &state)
+{
+    auto region = _textureHolder.getRegion(state.texture);
+    auto frame = state.frame;
+    auto colour = state.colour;
+    _spriteBatch.add(*region.texture,
+                     {region.rect.left + frame.left, region.rect.top + frame.top, frame.width, frame.height},
+                     _outputCentre + (state.getInterpolatedPosition(_interpolation) - _simulationCentre) * _outputScale,
+                     state.getInterpolatedScale(_interpolation) * _outputScale,
+                     state.getInterpolatedRotation(_interpolation),
+                     sf::Color(colour.r, colour.g, colour.b, colour.a));
+}
+
+void EntityRenderer::draw(RenderTarget &target, const RenderSnapshot &snapshot)
+{
+    if (!_isBatching)
+    {
+        for (const auto &sprite : snapshot.sprites)
+            target.draw(getSprite(sprite));
+        target.draw(getSprite(snapshot.playerShip));
+        _drawCalls = snapshot.sprites.size() + 1;
+        return;
+    }
+
+    _spriteBatch.clear();
+    for (const auto &sprite : snapshot.sprites)
+        addToBatch(sprite);
+    addToBatch(snapshot.playerShip);
+    _spriteBatch.draw(target);
+    _drawCalls = _spriteBatch.getBatchCount();
+}
@@ -0,0 +1,229 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Render layer for game entities
+///
+/// Builds the SFML sprite for an entity from its display state
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_ENTITYRENDERER_HPP
+#define PROJECT_ENTITYRENDERER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "common.hpp"
+#include "ResourceHolder.hpp"
+#include "Entity.hpp"
+#include "EntityPool.hpp"
+#include "RenderSnapshot.hpp"
+#include "SpriteBatch.hpp"
+
+using sf::Sprite;
+using sf::RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief EntityRenderer Class
+///
+/// The simulation entities (PlayerShip, Enemy, Bullet, Meteoroid, Explosion) only
+/// store their position, scale, rotation, colour and active texture frame.
+/// This class turns that state into an sf::Sprite, using the loaded textures,
+/// so that the simulation itself does not depend on SFML Graphics
+///
+/// Entities are simulated at a fixed resolution. setViewport() maps that
+/// simulation space onto a render target of any size: positions are scaled
+/// about the centre of the screen, and sprites by the same factor
+///
+/// The render thread draws from a RenderSnapshot, which holds the same state
+/// copied out of the entities by the simulation thread. A snapshot is drawn
+/// through a SpriteBatch, with one draw call per texture, unless batching
+/// is turned off. Once the gameplay textures are packed into an atlas
+/// (TextureHolder::packAtlas), that is one draw call per atlas page
+///
+/// \see Entity
+/// \see Animatable
+/// \see ResourceHolder
+////////////////////////////////////////////////////////////
+class EntityRenderer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor for the EntityRenderer
+    ///
+    /// \param textureHolder The textureHolder object, passed by const ref.
+    /// provides the sf::Texture for each entity's texture ID
+    ////////////////////////////////////////////////////////////
+    EntityRenderer(const TextureHolder &textureHolder);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sets how the simulation space is mapped onto the render target
+    ///
+    /// The play area (a circle of half the screen height) is scaled to fit
+    /// the output height, centred in the output. By default the mapping is
+    /// one to one
+    ///
+    /// \param simulationResolution The resolution the entities are simulated at
+    /// \param outputSize The size of the window (or texture) that is drawn to
+    ////////////////////////////////////////////////////////////
+    void setViewport(Vector2i simulationResolution, sf::Vector2u outputSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sets how far between the previous and current simulation step
+    /// the entities are drawn
+    ///
+    /// \param interpolation From 0 (the previous step) to 1 (the current step,
+    /// the default)
+    ///
+    /// \see Entity::storePreviousState
+    ////////////////////////////////////////////////////////////
+    void setInterpolation(float interpolation)
+    {_interpolation = interpolation;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sets whether a snapshot is drawn through the sprite batch (the
+    /// default), or with one draw call per sprite, for comparison
+    ///
+    /// \param isBatching True to batch the sprites by texture
+    ////////////////////////////////////////////////////////////
+    void setBatching(bool isBatching)
+    {_isBatching = isBatching;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns true if snapshots are drawn through the sprite batch
+    ////////////////////////////////////////////////////////////
+    bool isBatching() const
+    {return _isBatching;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the number of draw calls made for the last snapshot drawn
+    ////////////////////////////////////////////////////////////
+    std::size_t getDrawCalls() const
+    {return _drawCalls;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sets up the sprite to represent the entity on screen
+    ///
+    /// The same sprite object is reused for every entity, so the reference
+    /// is only valid until the next call
+    ///
+    /// \param entity The entity to build the sprite for
+    /// \return The sf::Sprite object representing the entity in the game
+    /// (dimensions, position, texture)
+    ///
+    /// \see [SFML/Sprite](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Sprite.php)
+    ////////////////////////////////////////////////////////////
+    const Sprite &getSprite(const Entity &entity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sets up the sprite from an entity's state in a RenderSnapshot
+    ///
+    /// \param state The copied state of the entity
+    /// \return The sf::Sprite object representing the entity (valid until the next call)
+    ///
+    /// \see RenderSnapshot
+    ////////////////////////////////////////////////////////////
+    const Sprite &getSprite(const SpriteState &state);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draws every sprite in a snapshot, then the playerShip
+    ///
+    /// Batched, the sprites of each texture (or atlas page) are drawn together,
+    /// in the order the textures first appear (the playerShip's texture is last).
+    /// With every texture in one page, that is the order of the snapshot
+    ///
+    /// \param target The window (or texture) to draw to
+    /// \param snapshot The snapshot to draw
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget &target, const RenderSnapshot &snapshot);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draws a single entity
+    ///
+    /// \param target The window (or texture) to draw onto
+    /// \param entity The entity to draw
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget &target, const Entity &entity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draws every entity in a list
+    ///
+    /// \param target The window (or texture) to draw onto
+    /// \param entities A list of entities of one kind, as returned by the EntityController
+    ////////////////////////////////////////////////////////////
+    template <typename EntityType>
+    void draw(RenderTarget &target, const std::vector<EntityType> &entities)
+    {
+        for (const auto &entity : entities)
+            draw(target, entity);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draws every entity in a pool
+    ///
+    /// \param target The window (or texture) to draw onto
+    /// \param entities A pool of entities of one kind, as returned by the EntityController
+    ////////////////////////////////////////////////////////////
+    template <typename EntityType>
+    void draw(RenderTarget &target, const EntityPool<EntityType> &entities)
+    {
+        for (const auto &entity : entities)
+            draw(target, entity);
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Adds an entity's state to the sprite batch, mapped and
+    /// interpolated as getSprite() does
+    ///
+    /// \param state The copied state of the entity
+    ////////////////////////////////////////////////////////////
+    void addToBatch(const SpriteState &state);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Texture holder, to access all game assets loaded in other context.
+    /// Is a reference as is not created in the EntityRenderer
+    ////////////////////////////////////////////////////////////
+    const TextureHolder &_textureHolder;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The sprite used to draw entities
+    ////////////////////////////////////////////////////////////
+    Sprite _sprite;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The centre of the screen in the simulation space
+    ////////////////////////////////////////////////////////////
+    Vector2f _simulationCentre;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The centre of the render target
+    ////////////////////////////////////////////////////////////
+    Vector2f _outputCentre;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The size of one simulation pixel on the render target
+    ////////////////////////////////////////////////////////////
+    float _outputScale;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief How far between the previous and current step entities are drawn
+    ////////////////////////////////////////////////////////////
+    float _interpolation;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The quads of the snapshot being drawn, by texture
+    ////////////////////////////////////////////////////////////
+    SpriteBatch _spriteBatch;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief True to draw snapshots through the sprite batch
+    ////////////////////////////////////////////////////////////
+    bool _isBatching;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of draw calls made for the last snapshot
+    ////////////////////////////////////////////////////////////
+    std::size_t _drawCalls;
+};
+
+#endif //PROJECT_ENTITYRENDERER_HPP
@@ -2,7 +2,6 @@
 /// \brief   Explosion entity for destroyed screen objects
 /////////////////////////////////////////////////////////////////////
 
-
 #include "Explosion.hpp"
 
 Explosion::Explosion(const Vector2i resolution,
@@ -10,23 +9,18 @@ Explosion::Explosion(const Vector2i resolution,
                      float angle,
                      float scale,
                      const entity::ID type,
-                     const TextureHolder &textureHolder,
-                     const textures::ID id) : Entity{resolution,
-                                                     distanceFromCentre,
-                                                     angle,
-                                                     scale,
-                                                     type,
-                                                     textureHolder}
+                     const textures::ID id,
+                     Random random) : Entity{resolution,
+                                             distanceFromCentre,
+                                             angle,
+                                             scale,
+                                             type}
 {
     _id = id;
     _lives = 1;
     _rectArea = {0, 0, 128, 128}; // Individual sprite tile
     _spriteOffset = _rectArea.width; // Animated sprite tile-set width
-    _sprite.setTexture(textureHolder.get(_id));
-    _sprite.setTextureRect(_rectArea);
-    _sprite.setOrigin(_sprite.getGlobalBounds().width / 2, _sprite.getGlobalBounds().height / 2);
-    _sprite.setScale(_scale, _scale);
-    _sprite.setRotation(rand()%360);
+    _rotation = random.nextInt(360);
     _isMoving = true;
     setMove(_angle,0); // Spawn on object
     move();
@@ -43,8 +37,10 @@ void Explosion::setMove(float angle, float distance)
 void Explosion::reset()
 {
     _isMoving = false;
-    _sprite.setPosition(_resolution.x*3,_resolution.y*3); // Move off-screen
-    _sprite.setScale(0,0);
+    setScreenPosition({float(_resolution.x*3), float(_resolution.y*3)}); // Move off-screen
+    _screenScale = {0, 0};
+    updateCollisionCircle();
+    storePreviousState();
 }
 
 void Explosion::update()
@@ -56,58 +52,14 @@ void Explosion::update()
         {
             die(); // only loop once
         }
-        _sprite.setTextureRect(_rectArea);
     }
 }
 
-const float Explosion::getRadius() const
-{
-    auto mid = Vector2f{_resolution.x/2.f,_resolution.y/2.f};
-    auto pos = Vector2f{_sprite.getPosition().x,_sprite.getPosition().y};
-    Vector2f length = mid-pos;
-    return sqrt((length.x * length.x) + (length.y * length.y));
-}
-
 const float Explosion::getDistanceFromCentre() const
 {
     return _distanceFromCentre;
 }
 
-const float Explosion::getAngle() const
-{
-    return _angle;
-}
-
-const Vector2f Explosion::getPosition() const
-{
-    return _sprite.getPosition();
-}
-
-const Sprite& Explosion::getSprite() const
-{
-    return _sprite;
-}
-
-const Vector2f Explosion::getScale() const
-{
-    return _sprite.getScale();
-}
-
-const int Explosion::getLives() const
-{
-    return _lives;
-}
-
-const entity::ID Explosion::getType() const
-{
-    return _type;
-}
-
-const bool Explosion::isAlive() const
-{
-    return _isAlive;
-}
-
 void Explosion::die()
 {
     _lives--;
@@ -123,16 +75,15 @@ void Explosion::move()
     auto offset = 0.f;
     auto depthScale = ((_distanceFromCentre + offset)/(_resolution.y/2));
     _distanceFromCentre += _futureMoveValue * depthScale;
-    auto x_pos = _distanceFromCentre * sin(common::degreeToRad(_angle));
-    auto y_pos = _distanceFromCentre * cos(common::degreeToRad(_angle));
-    auto scale = 1 + ((getRadius() - (_resolution.y / 2)) / (_resolution.y / 2));
-    _sprite.setPosition(x_pos+(_resolution.x / 2),y_pos+(_resolution.y / 2));
-    _sprite.setScale(scale * _scale,scale * _scale);
+    setPolarPosition(_distanceFromCentre, _angle);
+    auto scale = 1 + ((_polarRadius - (_resolution.y / 2)) / (_resolution.y / 2));
+    _screenScale = {scale * _scale, scale * _scale};
 
     // Dimming
-    auto dimColor = (scale*200) + 55;
-    if (getRadius() >= (_resolution.y/2))
+    auto dimColor = static_cast<unsigned char>((scale*200) + 55);
+    if (_polarRadius >= (_resolution.y/2))
     {
-        _sprite.setColor(Color(dimColor, dimColor, dimColor));
+        _colour = {dimColor, dimColor, dimColor, 255};
     }
+    updateCollisionCircle();
 }
\ No newline at end of file
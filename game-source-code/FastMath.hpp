@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Fast trigonometry for entity motion
+///
+/// Polynomial approximations of sin, cos and atan2 working in degrees
+/// (the unit used by every entity), and angle wrapping without fmod.
+/// Defining GYRUSS_EXACT_MATH switches every function to the standard
+/// library, for validation runs
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_FASTMATH_HPP
+#define PROJECT_FASTMATH_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cmath>
+
+namespace fastmath
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Radians per degree, as a float
+    ////////////////////////////////////////////////////////////
+    constexpr float radiansPerDegree = 0.0174532925199432958f;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Degrees per radian, as a float
+    ////////////////////////////////////////////////////////////
+    constexpr float degreesPerRadian = 57.2957795130823209f;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wraps an angle into the range [0, 360)
+    ///
+    /// Angles that are at most one turn out of range (the usual case, after
+    /// adding a small step) are wrapped with a single add or subtract, which
+    /// gives exactly the same result as fmod
+    ///
+    /// \param angle The angle in degrees
+    /// \return The same angle, from 0 up to (not including) 360
+    ////////////////////////////////////////////////////////////
+    inline float wrapDegrees(float angle)
+    {
+#ifdef GYRUSS_EXACT_MATH
+        angle = std::fmod(angle, 360.f);
+        if (angle < 0)
+            angle += 360;
+#else
+        if (angle >= 360)
+            angle -= 360;
+        else if (angle < 0)
+            angle += 360;
+
+        // More than one turn out of range
+        if (angle < 0 || angle >= 360)
+            angle -= 360 * std::floor(angle / 360);
+#endif
+        // A tiny negative angle can round up to 360 when wrapped
+        return angle < 360 ? angle : 0;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Calculates the sine and cosine of an angle together
+    ///
+    /// The angle is reduced (exactly, in degrees) to within 45 degrees of
+    /// a quarter turn, and both values come from the same minimax polynomials
+    /// on [-pi/4, pi/4]. The absolute error is below 3e-7 for any angle
+    /// within a million degrees of 0
+    ///
+    /// \param degrees The angle in degrees
+    /// \param sine Set to the sine of the angle
+    /// \param cosine Set to the cosine of the angle
+    ////////////////////////////////////////////////////////////
+    inline void sinCosDegrees(float degrees, float &sine, float &cosine)
+    {
+#ifdef GYRUSS_EXACT_MATH
+        auto radians = static_cast<double>(degrees) * (M_PI / 180);
+        sine = static_cast<float>(std::sin(radians));
+        cosine = static_cast<float>(std::cos(radians));
+#else
+        auto wrapped = wrapDegrees(degrees);
+        auto quadrant = static_cast<int>((wrapped + 45) / 90);
+        auto x = (wrapped - quadrant * 90.f) * radiansPerDegree;
+        auto x2 = x * x;
+        auto s = x + x * x2 * (-1.6666654611e-1f + x2 * (8.3321608736e-3f + x2 * -1.9515295891e-4f));
+        auto c = 1 - 0.5f * x2 + x2 * x2 * (4.166664568298827e-2f
+                                            + x2 * (-1.388731625493765e-3f + x2 * 2.443315711809948e-5f));
+        switch (quadrant & 3)
+        {
+            case 0 : sine = s;  cosine = c;  break;
+            case 1 : sine = c;  cosine = -s; break;
+            case 2 : sine = -s; cosine = -c; break;
+            default: sine = -c; cosine = s;  break;
+        }
+#endif
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Calculates the angle of the vector {x,y}, like std::atan2(y, x)
+    ///
+    /// The ratio of the smaller to the larger component is fed to a minimax
+    /// polynomial for atan on [0, 1], and the result is moved to the right
+    /// octant. The absolute error is below 2e-4 degrees
+    ///
+    /// \param y The second component of the vector
+    /// \param x The first component of the vector
+    /// \return The angle in degrees, from -180 to 180
+    ////////////////////////////////////////////////////////////
+    inline float atan2Degrees(float y, float x)
+    {
+#ifdef GYRUSS_EXACT_MATH
+        return static_cast<float>(std::atan2(y, x) * (180 / M_PI));
+#else
+        auto absX = std::fabs(x);
+        auto absY = std::fabs(y);
+        auto larger = absX > absY ? absX : absY;
+        if (larger == 0)
+            return 0;
+        auto ratio = (absX < absY ? absX : absY) / larger;
+        auto r2 = ratio * ratio;
+        auto angle = ratio * (0.99997726f + r2 * (-0.33262347f + r2 * (0.19354346f
+                     + r2 * (-0.11643287f + r2 * (0.05265332f + r2 * -0.01172120f)))));
+        angle *= degreesPerRadian;
+        if (absY > absX)
+            angle = 90 - angle;
+        if (x < 0)
+            angle = 180 - angle;
+        return y < 0 ? -angle : angle;
+#endif
+    }
+}
+
+#endif //PROJECT_FASTMATH_HPP
@@ -8,13 +8,12 @@
 /////////////////////////////////////////////////////////////////////
 
 #include "Game.hpp"
-
-#ifdef DEBUG_ONLY
 #include <sstream>
 #include <iostream>
-#endif // DEBUG_ONLY
 
-Game::Game()
+Game::Game(StressSettings stress) : _entityRenderer{_textures},
+                                    _score{_clock},
+                                    _stress{stress}
 {
     _resolution = sf::Vector2i{1920, 1080};
     sf::Image icon;
@@ -32,9 +31,10 @@ Game::Game()
     _mainWindow.setVerticalSyncEnabled(true);
     _mainWindow.setIcon(32, 32, icon.getPixelsPtr());
     _windowPosition = _mainWindow.getPosition();
+    _entityRenderer.setViewport(_resolution, _mainWindow.getSize());
 
-    _winCondition = 100; // Number of enemies needed to kill to win.
-    _gameState = game::GameState::Splash;
+    // A stress test skips the splash screen
+    _gameState = _stress.isEnabled() ? game::GameState::Playing : game::GameState::Splash;
     _shaking = 0;
 }
 
@@ -50,14 +50,8 @@ void Game::Start()
 void Game::startGameLoop()
 {
     Clock mainClock;
-    Clock totalTimer;
-    Clock speedTimer;
-    Clock aliveTimer;
-    Time timeSinceUpdate = sf::Time::Zero;
-    float timeStep = 1.f / 60.f;            // 60 frames per second
+    float timeStep = SimulationClock::timeStep; // 60 steps per second
     auto speedModifier = 0.35f;              // Defines how fast the game should be at the start
-    auto increaseSpeedThreshold = 1.5f;     // How often the game speeds up (in seconds)
-    auto globalSpeedIncrease = 0.025f;       // Game speeds up this amount every time that it increases
     _inputHandler.reset();                  // Clear all previous inputs in the inputHandler
 
     _mainWindow.clear(sf::Color::Black);
@@ -80,7 +74,8 @@ void Game::startGameLoop()
     ///-------------------------------------------
     ///  Game Playing starts
     ///-------------------------------------------
-    _score.reset();
+    if (_gameState != game::GameState::Playing)
+        return;
 
     // Load game music
     if(_soundController.loadMusic())
@@ -90,44 +85,65 @@ void Game::startGameLoop()
     auto numberOfStars = 60;
     StarField starField(_resolution, 3, numberOfStars);
 
-    // Generate playerShip object
+    // Generate the simulation: the playerShip, and the entityController to manage all
+    // game objects movement, creation and destruction (resets the score)
     auto shipPathRadiusPadding = 0.05f;
     const auto shipPathRadius = (_resolution.y / 2) - (_resolution.y * shipPathRadiusPadding);
-    const auto shipScale = 0.22;
-    PlayerShip playerShip(_resolution,
+    const auto shipScale = 0.22f;
+    Simulation simulation(_resolution,
                           shipPathRadius,
-                          0,
                           shipScale,
-                          entity::PlayerShip,
-                          _textures);
-
-    // Generate entityController object to manage all game objects movement, creation and destruction
-    EntityController entityController(_resolution,
-                                      playerShip,
-                                      _textures,
-                                      _score,
-                                      speedModifier);
+                          _score,
+                          _clock,
+                          speedModifier,
+                          Random{_random.next()});
+    // With one core the helper jobs cannot run alongside the loop that made
+    // them, so they would only add their overhead
+    if (std::thread::hardware_concurrency() > 1)
+        simulation.setJobSystem(&_jobs);
+    simulation.setStressMode(_stress);
 
     // Generate shield object for playerShip
     Shield shield(_resolution,
                   shipPathRadius,
                   0,
                   shipScale,
-                  _textures,
-                  playerShip);
+                  _textures);
 
     // Create a hud object to show current lives and game stats
     HUD hud(_resolution,
             _mainWindow,
-            _fonts,
-            _score,
-            playerShip);
+            _fonts);
 
     // Initialise the playerShip move sound
     _soundController.playSound(sounds::PlayerMove,0,100,true);
+    _playerShotsHeard = 0;
+    _enemyShotsHeard = 0;
+    _explosionsHeard = 0;
+    _playerDeathsHeard = 0;
+
+    // The first snapshot is the game before its first step. Publishing it before
+    // the thread starts means there is always a snapshot to draw
+    TripleBuffer<RenderSnapshot> snapshots;
+    simulation.capture(snapshots.getWriteBuffer());
+    snapshots.getWriteBuffer().stepTime = simulation.getRealTime();
+    snapshots.publish();
+
+    // Stress mode reports the tick rate and frame time, once a second and for
+    // the whole test (the clock belongs to the simulation thread once it starts)
+    Clock stressReportClock;
+    const auto stressStartTicks = _clock.getTicks();
+    auto stressReportTicks = stressStartTicks;
+    auto stressReportFrames = 0u;
+    auto stressFrames = 0u;
+
+    std::thread simulationThread([&simulation, &snapshots] {simulation.run(snapshots);});
+
+    // The timings of the phases of each frame (the simulation times its own steps)
+    Profiler frameProfiler;
 
     ///-------------------------------------------
-    ///  Main Game Loop (time advance)
+    ///  Main Game Loop (one frame per snapshot)
     ///-------------------------------------------
     while (_gameState == game::GameState::Playing)
     {
@@ -138,87 +154,117 @@ void Game::startGameLoop()
         Event event;
         while (_mainWindow.pollEvent(event))
         {
-            _inputHandler.pollInput(_gameState, playerShip, event);
+            _inputHandler.pollInput(_gameState, simulation.getInput(), event);
 
             #ifdef DEBUG_ONLY
             // Debug function (developer cheat keys to tweak and test game-play)
-            debugKeys(event, playerShip, entityController);
+            debugKeys(event, simulation);
             #endif // DEBUG_ONLY
         }
+        _inputHandler.setPlayerMove(simulation.getInput());
 
         // Frame timing events
-        timeSinceUpdate += mainClock.getElapsedTime();
-        mainClock.restart();
+        auto frameTime = mainClock.restart().asSeconds();
+
+        ///-------------------------------------------
+        /// Latest snapshot from the simulation thread
+        ///-------------------------------------------
+        snapshots.update();
+        const auto &snapshot = snapshots.getReadBuffer();
 
-        // Game gets faster the longer you stay alive
-        if(speedTimer.getElapsedTime().asSeconds() > increaseSpeedThreshold)
+        if (snapshot.playerDeaths != _playerDeathsHeard)
+        {
+            _playerDeathsHeard = snapshot.playerDeaths;
+            playerDeathEvents();
+        }
         {
-            speedTimer.restart();
-            entityController.changeGlobalSpeed(globalSpeedIncrease);
+            Profiler::Scope timer(frameProfiler, Profiler::PlayEventSounds);
+            playEventSounds(snapshot);
         }
 
         ///-------------------------------------------
-        ///  Fixed Timestep
+        ///  End game state
         ///-------------------------------------------
-        while (timeSinceUpdate.asSeconds() >= timeStep)
-        {
-            timeSinceUpdate = sf::Time::Zero;
-
-            entityController.spawnEntities();
-            entityController.setMove();
-            _inputHandler.setPlayerShipMove(playerShip, timeStep);
-            entityController.shoot();
-            entityController.checkClipping();
+        if (_gameState == game::GameState::Playing)
+            _gameState = snapshot.gameState;
 
-            ///-------------------------------------------
-            ///  Player Death
-            ///-------------------------------------------
-
-            // Returns true if the player has collided. (also does global entity collision check)
-            if (entityController.checkCollisions())
+        ///-------------------------------------------
+        ///  Render (once per frame, between the last two steps)
+        ///-------------------------------------------
+        if (_gameState == game::GameState::Playing)
+        {
+            auto interpolation = (simulation.getRealTime() - snapshot.stepTime) / timeStep;
+            interpolation = std::max(0.f, std::min(interpolation, 1.f));
+            shield.update(snapshot.ticksSinceRespawn);
             {
-                if (!playerShip.isInvulnerable())
-                {
-                    playerDeathEvents(playerShip, entityController);
-                }
+                Profiler::Scope timer(frameProfiler, Profiler::Render);
+                render(starField, shield, hud, snapshot, interpolation, frameTime);
             }
+            {
+                Profiler::Scope timer(frameProfiler, Profiler::Display);
+                _mainWindow.display(); // Main Render call
+            }
+        }
 
-            ///-------------------------------------------
-            /// Pre update() Sound events
-            ///-------------------------------------------
-            playEventSounds(playerShip, entityController);
-
-            ///-------------------------------------------
-            /// Update() all entities
-            ///-------------------------------------------
-            update(playerShip, entityController);
-
-            ///-------------------------------------------
-            ///  Render
-            ///-------------------------------------------
-            render(starField, playerShip, entityController, shield, hud);
+        if (_stress.isEnabled())
+        {
+            stressFrames++;
+            stressReportFrames++;
+            if (stressReportClock.getElapsedTime().asSeconds() >= 1)
+            {
+                auto seconds = stressReportClock.restart().asSeconds();
+                std::ostringstream title;
+                title << "Gyruss stress test - " << snapshot.sprites.size() << " sprites in "
+                      << _entityRenderer.getDrawCalls() << " draw calls, "
+                      << (snapshot.ticks - stressReportTicks) / seconds << " ticks/s, "
+                      << 1000 * seconds / stressReportFrames << " ms/frame";
+                _mainWindow.setTitle(title.str());
+                stressReportTicks = snapshot.ticks;
+                stressReportFrames = 0;
+            }
+        }
 
-            #ifdef DEBUG_ONLY
+        #ifdef DEBUG_ONLY
+        if (!_stress.isEnabled())
+        {
             fps.update();
             std::ostringstream ss;
             ss << fps.getFPS();
             _mainWindow.setTitle(ss.str());
-            #endif // DEBUG_ONLY
+        }
+        #endif // DEBUG_ONLY
+    }
 
-            ///-------------------------------------------
-            ///  End game state
-            ///-------------------------------------------
-            endGameCheck(playerShip);
+    simulation.stop();
+    simulationThread.join();
 
-        }
+    if (_stress.isEnabled())
+    {
+        auto seconds = simulation.getRealTime();
+        std::cout << "Stress test of " << _stress.enemies << " enemies and " << _stress.bullets
+                  << " bullets: " << (_clock.getTicks() - stressStartTicks) / seconds << " ticks/s, "
+                  << 1000 * seconds / std::max(1u, stressFrames) << " ms/frame over "
+                  << seconds << " s\n";
     }
-}
 
-void Game::update(PlayerShip &playerShip, EntityController &entityController)
-{
-    _score.update();
-    playerShip.update();
-    entityController.update();
+    // Where the time of the last few seconds went, step by step and frame by
+    // frame. Only when stress testing, or in debug mode
+    auto reportPhases = _stress.isEnabled();
+    #ifdef DEBUG_ONLY
+    reportPhases = true;
+    #endif // DEBUG_ONLY
+    if (reportPhases)
+    {
+        std::cout << "Step phases:\n";
+        simulation.getProfiler().report(std::cout);
+        std::cout << "Frame phases:\n";
+        frameProfiler.report(std::cout);
+    }
+
+    #ifdef DEBUG_ONLY
+    // Debug mode: report how full the entity pools got, for tuning their capacities
+    simulation.getEntityController().reportPoolUsage(std::cout);
+    #endif // DEBUG_ONLY
 }
 
 void Game::shakeWindow()
@@ -233,8 +279,8 @@ void Game::shakeWindow()
     {
         auto pos_temp = _windowPosition;
         auto shake_amount = 25;
-        _mainWindow.setPosition(Vector2i(pos_temp.x + rand() % shake_amount,
-                                         pos_temp.y + rand() % shake_amount));
+        _mainWindow.setPosition(Vector2i(pos_temp.x + _random.nextInt(shake_amount),
+                                         pos_temp.y + _random.nextInt(shake_amount)));
 
         if (++_shaking >= 5)
             _shaking = 0;
@@ -243,70 +289,60 @@ void Game::shakeWindow()
 }
 
 void Game::render(StarField &starField,
-                  const PlayerShip &playerShip,
-                  EntityController &entityController,
                   Shield &shield,
-                  HUD &hud)
+                  HUD &hud,
+                  const RenderSnapshot &snapshot,
+                  float interpolation,
+                  float frameTime)
 {
     _windowPosition = _mainWindow.getPosition();
     _mainWindow.clear(Color::Black);
 
-    for (const auto &element : starField.getStarField())
-        starField.moveAndDrawStars(_mainWindow, entityController.getSpeed() * 0.001f);
-
-    for (auto &enemy : entityController.getEnemies())
-        _mainWindow.draw(enemy->getSprite());
-
-    for (auto &bullet : entityController.getBulletsEnemy())
-        _mainWindow.draw(bullet->getSprite());
-
-    for (auto &bullet : entityController.getBulletsPlayer())
-        _mainWindow.draw(bullet->getSprite());
+    starField.update(frameTime, snapshot.speed * 3.6f);
+    starField.draw(_mainWindow);
 
-    for (auto &meteoroid : entityController.getMeteoroids())
-        _mainWindow.draw(meteoroid->getSprite());
+    _entityRenderer.setInterpolation(interpolation);
+    _entityRenderer.draw(_mainWindow, snapshot);
 
-    for (auto &explosion : entityController.getExplosions())
-        _mainWindow.draw(explosion->getSprite());
-
-    _mainWindow.draw(playerShip.getSprite());
-
-    if (playerShip.isInvulnerable())
+    if (snapshot.isInvulnerable)
     {
-        shield.update();
+        shield.move(snapshot.playerShip, interpolation);
         _mainWindow.draw(shield.getSprite());
-    } else shield.reset();
+    }
 
-    hud.draw();
+    hud.draw(snapshot);
 
     // Shake the screen in the event the the playerShip dies.
     while (_shaking > 0) shakeWindow();
     _mainWindow.setPosition(_windowPosition);
-
-    _mainWindow.display(); // Main Render call
 }
 
-void Game::playEventSounds( PlayerShip &playerShip, EntityController &entityController)
+void Game::playEventSounds(const RenderSnapshot &snapshot)
 {// Player move sound
-    _soundController.setPosition(sounds::PlayerMove, {playerShip.getPosition().x, playerShip.getPosition().y, -5});
-    _soundController.setPitch(sounds::PlayerMove, fabs(playerShip.getFutureAngle() / 4));  // Engine pitch rises to be audible when moving
+    auto playerPosition = snapshot.playerShip.position;
+    _soundController.setPosition(sounds::PlayerMove, {playerPosition.x, playerPosition.y, -5});
+    _soundController.setPitch(sounds::PlayerMove, fabs(snapshot.playerFutureAngle / 4));  // Engine pitch rises to be audible when moving
 
-    if (playerShip.isShooting())
+    if (snapshot.playerShots != _playerShotsHeard)
                 _soundController.playSound(sounds::PlayerShoot);
 
-    if (entityController.explosionOccurred())
+    if (snapshot.explosions != _explosionsHeard)
             {
                 // Vary the pitch of the explosions
-                auto pitch = (rand() % 3 + 0.8) / 3.f;
+                auto pitch = (_random.nextInt(3) + 0.8) / 3.f;
                 _soundController.playSound(sounds::Explosion, pitch, 50);
             }
 
-    if (entityController.shootingOccurred())
+    if (snapshot.enemyShots != _enemyShotsHeard)
             {
                 // Vary the pitch of the explosions
-                auto pitch = (rand() % 3 + 0.8) / 3.f;
+                auto pitch = (_random.nextInt(3) + 0.8) / 3.f;
                 _soundController.playSound(sounds::EnemyShoot, pitch, 90);
             }
+
+    _playerShotsHeard = snapshot.playerShots;
+    _explosionsHeard = snapshot.explosions;
+    _enemyShotsHeard = snapshot.enemyShots;
 }
 
 void Game::showSplashScreen()
@@ -365,6 +401,12 @@ void Game::loadResources()
     _textures.load(textures::Explosion, "resources/explosion.png");
     _textures.load(textures::Shield, "resources/shield.png");
 
+    // The gameplay textures share atlas pages, so the entities can be drawn together
+    _textures.packAtlas({textures::PlayerShip, textures::BulletPlayer, textures::BulletEnemy,
+                         textures::Meteoroid, textures::EnemyShipGrey, textures::EnemyShipPurple,
+                         textures::EnemyShipYellow, textures::Satellite, textures::Explosion,
+                         textures::Shield});
+
     // Load Fonts
     _fonts.load(fonts::Title, "resources/danube.ttf");
     _fonts.load(fonts::Default, "resources/fax_sans_beta.otf");
@@ -403,66 +445,39 @@ void Game::recordHighScore()
     return;
 }
 
-void Game::playerDeathEvents(PlayerShip &playerShip, EntityController &entityController)
+void Game::playerDeathEvents()
 {
-    playerShip.die();
-    _score.resetLifeTimer();
     _soundController.playSound(sounds::PlayerDeath);
     _soundController.playSound(sounds::Explosion);
     _inputHandler.reset();
-    entityController.resetGlobalSpeed();
-    entityController.killAllEnemiesOfType(entity::Satellite);
     _shaking = 1;
 }
 
-void Game::endGameCheck(const PlayerShip &playerShip)
-{
-    if (playerShip.getLives() <= 0)
-    {
-        //_score.resetLifeTimer();
-        _gameState = game::GameOverLose;
-    }
-
-    if(_score.getEnemiesKilled() >= _winCondition)
-    {
-        _score.resetLifeTimer();
-        _gameState = game::GameOverWin;
-    }
-}
-
 void Game::Quit()
 {
     _mainWindow.close();
 }
 
-void Game::debugKeys(const Event &event, PlayerShip &playerShip, EntityController &entityController)
+void Game::debugKeys(const Event &event, Simulation &simulation)
 {
     // Debug keys for game-play tuning and developer usage
-    auto speedChange = 0.1f;
     if (event.type == Event::KeyPressed)
     {
         if (event.key.code == Keyboard::RBracket)
-            entityController.changeGlobalSpeed(speedChange);
+            simulation.request(Simulation::SpeedUp);
         if (event.key.code == Keyboard::LBracket)
-            entityController.changeGlobalSpeed(-speedChange);
+            simulation.request(Simulation::SlowDown);
         if (event.key.code == Keyboard::P)
-            playerShip.makeInvulnerable(true);
+            simulation.request(Simulation::MakeInvulnerable);
         if (event.key.code == Keyboard::O)
-            playerShip.makeInvulnerable(false);
+            simulation.request(Simulation::MakeVulnerable);
         if (event.key.code == Keyboard::K)
-            playerDeathEvents(playerShip, entityController);
+            simulation.request(Simulation::KillPlayerShip);
         if (event.key.code == Keyboard::L)
-            playerShip.upgrade();
+            simulation.request(Simulation::UpgradePlayerShip);
         if (event.key.code == Keyboard::I)
-        {
-            auto enemyType = static_cast<entity::ID >(rand() % 2);
-            auto textureVariant = static_cast<textures::ID>(rand() % 2);
-            auto movementDir = static_cast<MovementDirection >(rand() % 2);
-            auto movementState = static_cast<MovementState>(rand() % 5);
-            entityController.spawnBasicEnemy(enemyType,
-                                             textureVariant,
-                                             movementDir,
-                                             movementState);
-        }
+            simulation.request(Simulation::SpawnEnemy);
+        if (event.key.code == Keyboard::B) // Compare batched and per-sprite drawing
+            _entityRenderer.setBatching(!_entityRenderer.isBatching());
     }
-}
\ No newline at end of file
+}
@@ -15,6 +15,7 @@
 #include "common.hpp"
 #include "Entity.hpp"
 #include "EntityController.hpp"
+#include "EntityRenderer.hpp"
 #include "ResourceHolder.hpp"
 #include "SoundController.hpp"
 #include "InputHandler.hpp"
@@ -24,6 +25,9 @@
 #include "FPS.hpp"
 #include "HUD.hpp"
 #include "Shield.hpp"
+#include "Simulation.hpp"
+#include "TripleBuffer.hpp"
+#include <thread>
 
 using sf::Vector2i;
 using sf::RenderWindow;
@@ -34,6 +38,7 @@ using std::ifstream;
 using std::ofstream;
 using std::runtime_error;
 using sf::Event;
+using sf::Color;
 
 ////////////////////////////////////////////////////////////
 /// \brief The main Game class
@@ -41,8 +46,11 @@ using sf::Event;
 /// This class manages all game loops and creation of all game events and objects,
 /// the game states, and basic game logic.
 /// It also generates instances of all other controllers and handlers,
-/// such as EntityController, InputHandler and the various types of ResourceHandler.
-/// It is directly responsible for the playerShipObject.
+/// such as the Simulation, InputHandler and the various types of ResourceHandler.
+///
+/// During game play the Simulation (playerShip, EntityController, Score) runs on
+/// a thread of its own. The main thread handles window events, sounds and drawing,
+/// all from the latest RenderSnapshot the simulation has published.
 ////////////////////////////////////////////////////////////
 class Game
 {
@@ -50,9 +58,12 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Constructor for the main Game class.
     ///
-    /// Sets the win condition, and the initial game state.
+    /// Creates the window, and sets the initial game state.
+    ///
+    /// \param stress The populations of a stress test, which starts straight
+    /// away and reports its tick rate and frame time. Normal play by default
     ////////////////////////////////////////////////////////////
-    Game();
+    explicit Game(StressSettings stress = StressSettings{});
 
     ////////////////////////////////////////////////////////////
     /// \brief Starts the game.
@@ -79,13 +90,14 @@ private:
     /// \brief This is the main game loop that is used throughout game play.
     ///
     /// Loop begins by setting up all things needed going forward, such as clocks and predefined variables.
-    /// It also is used in the creation of key objects, namely: PlayerShip, Shield, Score, EntityController and HUD.
-    /// This function holds the game in the mainGame loop during game play and deals with player death sound and draw events.
+    /// It also is used in the creation of key objects, namely: Simulation, Shield and HUD.
+    /// The simulation thread is started, and this function holds the game in the mainGame loop
+    /// during game play, drawing each new snapshot and dealing with player death sound and draw events.
+    /// The simulation thread is joined before it returns.
     ///
-    /// \see PlayerShip
+    /// \see Simulation
+    /// \see RenderSnapshot
     /// \see Shield
-    /// \see Score
-    /// \see EntityController
     /// \see HUD
     ////////////////////////////////////////////////////////////
     void startGameLoop();
@@ -107,7 +119,8 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Pre-loads all required game resources.
     ///
-    /// This loads all requires game assets, using ResourceHolder objects
+    /// This loads all requires game assets, using ResourceHolder objects,
+    /// then packs the gameplay textures into an atlas
     /// \see ResourceHolder
     /// \see ResourceHolder.inl
     ////////////////////////////////////////////////////////////
@@ -122,55 +135,40 @@ private:
     void recordHighScore();
 
     ////////////////////////////////////////////////////////////
-    /// \brief When game sounds are generated in the main game loop(player shooting, explosions etc.)
+    /// \brief When game sounds are generated by the simulation (player shooting, explosions etc.)
     /// this function plays the sound.
     ///
-    /// \param playerShip checks for the playerShip shooting event and plays a sound accordingly
-    /// \param entityController check entities for shooting and explosions and plays sounds accordingly
-    ////////////////////////////////////////////////////////////
-    void playEventSounds(PlayerShip &playerShip, EntityController &entityController);
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Updates all game events, called on every frame.
-    ///
-    /// Updates score object, playerShip status and all game entities
+    /// Each kind of event is played once if it happened since the last snapshot heard,
+    /// however many steps it happened in
     ///
-    /// \param playerShip is updated to execute its next planned move
-    /// \param entityController updates all current alive entities.
+    /// \param snapshot The latest snapshot, with the running counts of each event
     ////////////////////////////////////////////////////////////
-    void update(PlayerShip &playerShip, EntityController &entityController);
+    void playEventSounds(const RenderSnapshot &snapshot);
 
     ////////////////////////////////////////////////////////////
     /// \brief Used to draw all game elements by looping over all vectors of entities
     /// and drawing the underlying sprite. Called on every frame.
+    /// The caller displays the frame, so that drawing and displaying are timed apart
     ///
     /// \param starField object drawn on every frame
-    /// \param playerShip current playerShip sprite at location is drawn
-    /// \param entityController returns all other non playerShip sprites to be drawn
-    /// \param shield is drawn, irrespective if its visible or not
+    /// \param shield is drawn over the playerShip while it is invulnerable
     /// \param hud object is drawn to screen to show play statistics
-    ////////////////////////////////////////////////////////////
-    void render(StarField &starField, const PlayerShip &playerShip,
-                EntityController &entityController, Shield &shield, HUD &hud);
-
-    ////////////////////////////////////////////////////////////
-    /// \breif On each frame, verify if the player has lost all lives or has met the win condition
-    ///
-    /// When the end game condition is met, the game state is changed to either a loose or win
-    /// based on how the game ended
-    ///
-    /// \param playerShip object is needed to check current number of player lives
-    ////////////////////////////////////////////////////////////
-    void endGameCheck(const PlayerShip &playerShip);
+    /// \param snapshot The latest snapshot of the simulation, with every sprite to be drawn
+    /// \param interpolation How far the frame is between the previous (0) and
+    /// current (1) simulation step. Entities are drawn between the two
+    /// \param frameTime The length of the frame in seconds (the starField
+    /// moves by this much)
+    ////////////////////////////////////////////////////////////
+    void render(StarField &starField, Shield &shield, HUD &hud,
+                const RenderSnapshot &snapshot,
+                float interpolation, float frameTime);
 
     ////////////////////////////////////////////////////////////
-    /// \brief When the player dies, specific functions need to be called such as reducing a player
-    /// life, playing sounds, remove all satellites from play and resetting the game speed.
-    ///
-    /// \param playerShip object is needed to decrement a life from the player
-    /// \param entityController is needed to remove all current flying Satellites
+    /// \brief When the player dies, the death sounds are played, the held keys are
+    /// released and the window shakes. (The simulation has already taken a life,
+    /// removed the Satellites and reset the game speed.)
     ////////////////////////////////////////////////////////////
-    void playerDeathEvents(PlayerShip &playerShip, EntityController &entityController);
+    void playerDeathEvents();
 
     ////////////////////////////////////////////////////////////
     /// \brief When the player dies, the game window shakes to give visual feedback.
@@ -181,11 +179,13 @@ private:
     /// \brief Set of keys are bound to enable the developer to add extra sprites, make the PlayerShip invulnerable
     /// or change the game speed.
     ///
+    /// The keys are sent to the simulation thread as commands, run on its next step.
+    /// B switches sprite batching on and off, on the render thread
+    ///
     /// \param event used to read in key presses
-    /// \param playerShip used to change the player ship state
-    /// \param entityController spawn enemies on key press
+    /// \param simulation the running game, to send the commands to
     ////////////////////////////////////////////////////////////
-    void debugKeys(const Event &event, PlayerShip &playerShip, EntityController &entityController);
+    void debugKeys(const Event &event, Simulation &simulation);
 
     ////////////////////////////////////////////////////////////
     /// \brief A ResourceHolder of type Texture to store all game art assets
@@ -193,6 +193,12 @@ private:
     ////////////////////////////////////////////////////////////
     TextureHolder _textures;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Builds and draws the sprites for the game entities from the _textures
+    /// \see EntityRenderer
+    ////////////////////////////////////////////////////////////
+    EntityRenderer _entityRenderer;
+
     ////////////////////////////////////////////////////////////
     /// \brief A ResourceHolder of type SoundBuffer to load and play all game sounds
     /// \see [SFML/Sound](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Sound.php)
@@ -230,15 +236,30 @@ private:
     Vector2i _resolution;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Integer to store the number of enemies that must be killed to end the game
+    /// \brief The simulation clock, advanced once per fixed step by the Simulation.
+    /// All game timers measure game time on it (declared before the objects that use it)
+    ///
+    /// \see SimulationClock
     ////////////////////////////////////////////////////////////
-    int _winCondition;
+    SimulationClock _clock;
 
     ////////////////////////////////////////////////////////////
     /// \brief Score object to store the current game score, such as enemies killed and longest life
+    ///
+    /// Only the simulation thread uses it while a game is running
     ////////////////////////////////////////////////////////////
     Score _score;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief The event counts of the last snapshot heard, so that each
+    /// event is only played once
+    /// \see playEventSounds
+    ////////////////////////////////////////////////////////////
+    unsigned int _playerShotsHeard;
+    unsigned int _enemyShotsHeard;
+    unsigned int _explosionsHeard;
+    unsigned int _playerDeathsHeard;
+
     ////////////////////////////////////////////////////////////
     /// \brief Vector to store the starting location of the screen so after a shaking event the
     /// screen is position back where it started
@@ -249,6 +270,24 @@ private:
     /// \brief Controls the shaking of the main renderWindow when a player loses a life
     ////////////////////////////////////////////////////////////
     int _shaking;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The random stream for this game instance. Each round's
+    /// Simulation is seeded from it
+    ////////////////////////////////////////////////////////////
+    Random _random;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Worker threads the simulation spreads large entity loops over
+    ///
+    /// \see EntityController::setJobSystem
+    ////////////////////////////////////////////////////////////
+    JobSystem _jobs;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The populations of a stress test (all zero in normal play)
+    ////////////////////////////////////////////////////////////
+    StressSettings _stress;
 };
 
 #endif //PROJECT_GAME_HPP
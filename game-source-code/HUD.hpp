@@ -7,9 +7,9 @@
 #define PROJECT_HUD_HPP
 
 #include "SFML/Graphics.hpp"
+#include <string>
 #include "ResourceHolder.hpp"
-#include "Score.hpp"
-#include "PlayerShip.hpp"
+#include "RenderSnapshot.hpp"
 #include "common.hpp"
 
 using sf::RenderWindow;
@@ -18,9 +18,14 @@ using sf::Vector2i;
 ////////////////////////////////////////////////////////////
 /// \brief HUD class, to inform the user of remaining lives and other game information
 ///
-/// Sources information from the score object from game
+/// Sources information from the latest snapshot of the simulation
 ///
-/// \see Score
+/// The texts and life blocks are built once, and a text's string (and so
+/// its glyphs and origin) is only set again when the value it shows changes:
+/// the score and kills on a kill, the time alive once a second. Most frames
+/// only draw
+///
+/// \see RenderSnapshot
 ////////////////////////////////////////////////////////////
 class HUD
 {
@@ -31,24 +36,39 @@ public:
     /// \param resolution stores the size of the screen so the HUD knows where to position itself
     /// \param renderWindow enables the HUD to draw directly onto the game screen
     /// \param fontHolder is used to pass the required fonts to the HUD
-    /// \param score object enables the HUD to display the current game score, calculated and stored in score object
-    /// \param playerShip provides the playerShip state to the HUD, so the player can see if his is alive/dead/invulnerable
     ///
     /// \see [SFML/RenderWindow](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1RenderWindow.php)
     /// \see [SFML/Vector2](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Vector2.php)
-    /// \see PlayerShip
     ////////////////////////////////////////////////////////////
     HUD(const Vector2i resolution,
         RenderWindow &renderWindow,
-        const FontHolder &fontHolder,
-        const Score &score,
-        const PlayerShip &playerShip);
+        const FontHolder &fontHolder);
     ////////////////////////////////////////////////////////////
     /// \brief Appends the HUD to the current game renderWindow for the current lives and game score
+    ///
+    /// \param snapshot The latest snapshot of the simulation, with the score and
+    /// the playerShip state, so the player can see if they are alive/dead/invulnerable
     ////////////////////////////////////////////////////////////
-    void draw();
+    void draw(const RenderSnapshot &snapshot);
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Updates the texts whose values have changed since the last snapshot drawn
+    ///
+    /// \param snapshot The snapshot about to be drawn
+    ////////////////////////////////////////////////////////////
+    void update(const RenderSnapshot &snapshot);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sets the string of a text, and its origin to match
+    ///
+    /// \param text The text to change
+    /// \param string The new string
+    /// \param isRightAligned True to place the text by its right edge,
+    /// otherwise by its left edge (in both cases, vertically centred)
+    ////////////////////////////////////////////////////////////
+    void setText(sf::Text &text, const std::string &string, bool isRightAligned);
+
     ////////////////////////////////////////////////////////////
     /// \brief Vector to store the game resolution, to enable the HUD to know its internal deterministically generated dimensions
     ////////////////////////////////////////////////////////////
@@ -66,15 +86,34 @@ private:
     const FontHolder& _fonts;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Reference to the main score object, so the HUD to draw the latest player score
-    /// \see Score
+    /// \brief The texts drawn: "LIVES" (or "LIFE"), the kills left, "SCORE",
+    /// the score, the playerShip's status and the seconds alive
+    ////////////////////////////////////////////////////////////
+    sf::Text _livesTitle;
+    sf::Text _killsRemaining;
+    sf::Text _scoreTitle;
+    sf::Text _score;
+    sf::Text _statusTitle;
+    sf::Text _timeAlive;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief A block for each life left, up to three
+    ////////////////////////////////////////////////////////////
+    sf::CircleShape _lifeBlocks[3];
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The values the texts show, to tell when they change
     ////////////////////////////////////////////////////////////
-    const Score& _score;
+    int _shownLives;
+    unsigned int _shownKillsRemaining;
+    unsigned int _shownScore;
+    const char *_shownStatus;
+    unsigned int _shownSecondsAlive;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Reference to the main playerShip, the so HUD can know the ship current state.
+    /// \brief False until the texts have been set from a snapshot
     ////////////////////////////////////////////////////////////
-    const PlayerShip& _playerShip;
+    bool _isSet;
 };
 
 #endif //PROJECT_HUD_HPP
@@ -11,7 +11,7 @@ InputHandler::InputHandler() : _previousButtonState{false}
 {}
 
 void InputHandler::pollInput(game::GameState &gameState,
-                             PlayerShip &playerShip,
+                             PlayerInput &input,
                              const Event &event)
 {
     if (event.type == Event::Closed)
@@ -40,7 +40,7 @@ void InputHandler::pollInput(game::GameState &gameState,
         if (event.key.code == Keyboard::Space)
             if (_previousButtonState == 0)
             {
-                playerShip.setShoot();
+                input.shoot();
                 _previousButtonState = true;
             }
     }
@@ -62,9 +62,9 @@ void InputHandler::pollInput(game::GameState &gameState,
     }
 }
 
-void InputHandler::setPlayerShipMove(PlayerShip &playerShip, const float deltaTime)
+void InputHandler::setPlayerMove(PlayerInput &input)
 {
-    const auto moveAmount = 260.f;
+    const auto moveAmount = 260.f; // Per second of game time
     auto move = 0.f;
 
     if (_isMovingLeft)
@@ -77,7 +77,7 @@ void InputHandler::setPlayerShipMove(PlayerShip &playerShip, const float deltaTi
         move += moveAmount;
     }
 
-    playerShip.setMove(move * deltaTime);
+    input.setMove(move);
 }
 
 void InputHandler::reset()
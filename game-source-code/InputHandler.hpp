@@ -11,7 +11,9 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
-#include "EntityController.hpp"
+#include <SFML/Window.hpp>
+#include "common.hpp"
+#include "PlayerInput.hpp"
 #include <map>
 
 using keyMap = std::map<int, bool>;
@@ -37,27 +39,24 @@ public:
     /// \brief Polls the keyboard input events
     ///
     /// \param gameState Closing the window sets the gameState to Exiting, so the game will close.
-    /// \param playerShip The playerShip is strongly coupled to inputHandler, as the objects are interdependent
+    /// \param input The controls of the simulation, which fire the playerShip's gun on each press of space
     /// \param event The sf::Event Object is passed by ref from Game, to capture keyboard input during the polling period
-    /// \see PlayerShip
+    /// \see PlayerInput
     /// \see [SFML/Event]https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Event.php()
     /// \see Game
     ////////////////////////////////////////////////////////////
     void pollInput(game::GameState &gameState,
-                   PlayerShip &playerShip,
+                   PlayerInput &input,
                    const Event &event);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Sets up any player movement on the playerShip setMove() command,
-    /// depending on the input during the polling
+    /// \brief Sets the playerShip's move, depending on the keys held down during the polling
     ///
-    /// \param playerShip The playerShip object to set a move up for (planned but not performed)
-    /// \param deltaTime The amount of time that has passed since the previous update
-    /// \see PlayerShip
+    /// \param input The controls of the simulation, which move the playerShip on every step
+    /// \see PlayerInput
     /// \see Game
     ////////////////////////////////////////////////////////////
-    void setPlayerShipMove(PlayerShip &playerShip,
-                           const float deltaTime);
+    void setPlayerMove(PlayerInput &input);
 
     ////////////////////////////////////////////////////////////
     /// \brief Resets the inputHandler object
@@ -0,0 +1,172 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   A pool of worker threads that share out jobs by stealing
+/////////////////////////////////////////////////////////////////////
+
+#include "JobSystem.hpp"
+
+namespace
+{
+    // The JobSystem and queue of the worker running on this thread, so that
+    // jobs submitted from inside a job go to the worker's own queue
+    thread_local const JobSystem *currentJobSystem = nullptr;
+    thread_local unsigned int currentQueue = 0;
+}
+
+JobSystem::JobSystem(unsigned int numberOfThreads) : _unfinishedJobs{0},
+                                                     _queuedJobs{0},
+                                                     _nextQueue{0},
+                                                     _stopping{false}
+{
+    if (numberOfThreads == 0)
+        numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (auto i = 0u; i < numberOfThreads; i++)
+        _queues.emplace_back(new Queue);
+    for (auto i = 0u; i < numberOfThreads; i++)
+        _threads.emplace_back(&JobSystem::work, this, i);
+}
+
+JobSystem::~JobSystem()
+{
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _stopping = true;
+    }
+    _jobSubmitted.notify_all();
+    for (auto &thread : _threads)
+        thread.join();
+}
+
+void JobSystem::submit(Job job)
+{
+    auto index = currentJobSystem == this ? currentQueue
+                                          : _nextQueue++ % _queues.size();
+    _unfinishedJobs++;
+    {
+        std::lock_guard<std::mutex> lock(_queues[index]->mutex);
+        _queues[index]->jobs.push_back(std::move(job));
+    }
+    {
+        // Counted under the sleep mutex, so a worker about to sleep cannot miss it
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _queuedJobs++;
+    }
+    _jobSubmitted.notify_one();
+}
+
+void JobSystem::wait()
+{
+    while (_unfinishedJobs > 0)
+    {
+        if (runOneJob(_nextQueue++ % _queues.size()))
+            continue;
+
+        // Everything left is already running on the workers
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _allJobsFinished.wait(lock, [this] {return _unfinishedJobs == 0;});
+    }
+}
+
+void JobSystem::parallelFor(std::size_t count,
+                            std::size_t minimumChunkSize,
+                            const std::function<void(std::size_t begin, std::size_t end)> &body)
+{
+    // One chunk per worker plus one for the calling thread, if there are enough indices
+    minimumChunkSize = std::max<std::size_t>(1, minimumChunkSize);
+    auto chunks = std::min<std::size_t>(_threads.size() + 1,
+                                        (count + minimumChunkSize - 1) / minimumChunkSize);
+    if (chunks <= 1)
+    {
+        if (count > 0) body(0, count);
+        return;
+    }
+
+    auto chunkSize = (count + chunks - 1) / chunks;
+    chunks = (count + chunkSize - 1) / chunkSize;
+    Loop loop(body, count, chunkSize, chunks);
+    for (auto helper = std::size_t{1}; helper < chunks; helper++)
+    {
+        submit([&loop] {
+            runChunks(loop);
+            std::lock_guard<std::mutex> lock(loop.mutex);
+            if (--loop.unfinishedHelpers == 0)
+                loop.helpersFinished.notify_one();
+        });
+    }
+    runChunks(loop);
+
+    // Run any job (the helpers may still be queued behind long jobs) until
+    // none are left to take, then sleep until the running helpers finish
+    auto index = currentJobSystem == this ? currentQueue
+                                          : _nextQueue++ % _queues.size();
+    while (loop.unfinishedHelpers > 0 && runOneJob(index))
+        continue;
+    std::unique_lock<std::mutex> lock(loop.mutex);
+    loop.helpersFinished.wait(lock, [&loop] {return loop.unfinishedHelpers == 0;});
+}
+
+void JobSystem::runChunks(Loop &loop)
+{
+    for (auto chunk = loop.nextChunk++; chunk < loop.chunks; chunk = loop.nextChunk++)
+    {
+        auto begin = chunk * loop.chunkSize;
+        loop.body(begin, std::min(loop.count, begin + loop.chunkSize));
+    }
+}
+
+void JobSystem::work(unsigned int index)
+{
+    currentJobSystem = this;
+    currentQueue = index;
+    while (true)
+    {
+        if (runOneJob(index))
+            continue;
+
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _jobSubmitted.wait(lock, [this] {return _stopping || _queuedJobs > 0;});
+        if (_stopping && _queuedJobs <= 0)
+            return;
+    }
+}
+
+bool JobSystem::runOneJob(unsigned int index)
+{
+    Job job;
+
+    // Own queue first, newest job (its data is most likely still in cache)
+    {
+        std::lock_guard<std::mutex> lock(_queues[index]->mutex);
+        auto &jobs = _queues[index]->jobs;
+        if (!jobs.empty())
+        {
+            job = std::move(jobs.back());
+            jobs.pop_back();
+        }
+    }
+
+    // Otherwise steal the oldest job from the next queue that has one
+    for (auto i = 1u; !job && i < _queues.size(); i++)
+    {
+        auto &victim = *_queues[(index + i) % _queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty())
+        {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+        }
+    }
+
+    if (!job)
+        return false;
+
+    _queuedJobs--;
+    job();
+    if (--_unfinishedJobs == 0)
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _allJobsFinished.notify_all();
+    }
+    return true;
+}
@@ -0,0 +1,213 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   A pool of worker threads that share out jobs by stealing
+///
+/// Each worker has its own queue of jobs. A worker that runs out of work
+/// takes jobs from the other end of another worker's queue, so a few long
+/// jobs (e.g. whole games) are spread across every core without a central
+/// queue that all the threads contend for
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_JOBSYSTEM_HPP
+#define PROJECT_JOBSYSTEM_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+////////////////////////////////////////////////////////////
+/// \brief JobSystem Class
+///
+/// Jobs are submitted round-robin to the worker queues (or, from inside a
+/// job, to the worker's own queue). A worker runs the newest job from its
+/// own queue first, and otherwise steals the oldest job from the next
+/// queue that has one. Workers sleep while there is nothing to do.
+///
+/// wait() does not just block: the calling thread runs jobs too, until
+/// every submitted job has finished. parallelFor() splits a loop over
+/// many entities into jobs, and waits for just those jobs.
+///
+/// \see BatchRunner
+/// \see EntityController
+////////////////////////////////////////////////////////////
+class JobSystem
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief A unit of work
+    ////////////////////////////////////////////////////////////
+    using Job = std::function<void()>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor, starting the worker threads
+    ///
+    /// \param numberOfThreads The number of workers (0 for one per core).
+    /// The thread calling wait() works as well, so a single worker still
+    /// gives two threads
+    ////////////////////////////////////////////////////////////
+    explicit JobSystem(unsigned int numberOfThreads = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor, finishing the remaining jobs and joining the workers
+    ////////////////////////////////////////////////////////////
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+
+    JobSystem &operator=(const JobSystem&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queues a job to run on any thread
+    ///
+    /// \param job The job. It may submit more jobs
+    ////////////////////////////////////////////////////////////
+    void submit(Job job);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Runs jobs on the calling thread until every submitted job has finished
+    ///
+    /// Must not be called from inside a job
+    ////////////////////////////////////////////////////////////
+    void wait();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Runs body over the index range [0, count), split into chunks
+    /// across the threads, and returns when every chunk has finished
+    ///
+    /// The calling thread and one helper job per other chunk take the chunks
+    /// in turn from a counter they share, so the jobs only hold a reference
+    /// to the loop and do not allocate. When it runs out of chunks, the
+    /// calling thread runs other jobs until none are left to take, then
+    /// sleeps until the helpers have finished, so it may be called from
+    /// inside a job. A range too small to give every thread at least
+    /// minimumChunkSize indices is split into fewer chunks, and one chunk is
+    /// run inline without any jobs.
+    ///
+    /// \param count The number of indices
+    /// \param minimumChunkSize The fewest indices worth handing to another thread
+    /// \param body Called with the begin and end of each chunk. Chunks may
+    /// run at the same time, so body must only touch its own indices
+    ////////////////////////////////////////////////////////////
+    void parallelFor(std::size_t count,
+                     std::size_t minimumChunkSize,
+                     const std::function<void(std::size_t begin, std::size_t end)> &body);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the number of worker threads
+    ////////////////////////////////////////////////////////////
+    unsigned int getThreadCount() const
+    {return static_cast<unsigned int>(_threads.size());}
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief One worker's jobs. The owner takes from the back, thieves from the front
+    ////////////////////////////////////////////////////////////
+    struct Queue
+    {
+        std::mutex mutex;       /*!< Guards the jobs */
+        std::deque<Job> jobs;   /*!< The jobs waiting to run */
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief One call of parallelFor, shared by the calling thread and its helper jobs
+    ////////////////////////////////////////////////////////////
+    struct Loop
+    {
+        Loop(const std::function<void(std::size_t, std::size_t)> &body,
+             std::size_t count,
+             std::size_t chunkSize,
+             std::size_t chunks) : body(body),
+                                   count{count},
+                                   chunkSize{chunkSize},
+                                   chunks{chunks},
+                                   nextChunk{0},
+                                   unfinishedHelpers{chunks - 1} {}
+
+        const std::function<void(std::size_t, std::size_t)> &body; /*!< The loop body */
+        const std::size_t count;                        /*!< The number of indices */
+        const std::size_t chunkSize;                    /*!< The indices in each chunk (fewer in the last) */
+        const std::size_t chunks;                       /*!< The number of chunks */
+        std::atomic<std::size_t> nextChunk;             /*!< The first chunk not yet taken */
+        std::atomic<std::size_t> unfinishedHelpers;     /*!< The helper jobs not yet finished */
+        std::mutex mutex;                               /*!< Guards the sleeping of the calling thread */
+        std::condition_variable helpersFinished;        /*!< Wakes the calling thread when the last helper finishes */
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Runs chunks of a loop until every chunk has been taken
+    ///
+    /// \param loop The loop to take the chunks from
+    ////////////////////////////////////////////////////////////
+    static void runChunks(Loop &loop);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The body of each worker thread
+    ///
+    /// \param index The worker's queue
+    ////////////////////////////////////////////////////////////
+    void work(unsigned int index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Runs one job: the newest from the given queue, or else one stolen from another
+    ///
+    /// \param index The queue to look in first
+    /// \return True if a job was run, false if every queue was empty
+    ////////////////////////////////////////////////////////////
+    bool runOneJob(unsigned int index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The queue of each worker
+    ////////////////////////////////////////////////////////////
+    std::vector<std::unique_ptr<Queue>> _queues;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The worker threads
+    ////////////////////////////////////////////////////////////
+    std::vector<std::thread> _threads;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of jobs submitted but not yet finished
+    ////////////////////////////////////////////////////////////
+    std::atomic<unsigned int> _unfinishedJobs;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of jobs waiting in the queues (briefly negative
+    /// if a job is taken before its submit() has counted it)
+    ////////////////////////////////////////////////////////////
+    std::atomic<int> _queuedJobs;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The queue the next job from outside the workers goes to
+    ////////////////////////////////////////////////////////////
+    std::atomic<unsigned int> _nextQueue;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set by the destructor, to end the workers
+    ////////////////////////////////////////////////////////////
+    bool _stopping;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Guards _stopping, and the sleeping of idle threads
+    ////////////////////////////////////////////////////////////
+    std::mutex _sleepMutex;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wakes sleeping workers when a job is submitted
+    ////////////////////////////////////////////////////////////
+    std::condition_variable _jobSubmitted;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wakes wait() when the last job finishes
+    ////////////////////////////////////////////////////////////
+    std::condition_variable _allJobsFinished;
+};
+
+#endif //PROJECT_JOBSYSTEM_HPP
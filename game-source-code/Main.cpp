@@ -8,11 +8,36 @@
 /// \copyright (c) 2017 Tyson Cross and Chris Maree, Wits University
 /////////////////////////////////////////////////////////////////////
 
+#include <iostream>
+#include <string>
 #include "Game.hpp"
 
+////////////////////////////////////////////////////////////
+/// game [--stress [enemies] [bullets]]
+///
+/// --stress starts a stress test instead of a normal game, keeping
+/// 1000 enemies and 10000 enemy bullets in play unless told otherwise
+////////////////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
-    Game game;
+    StressSettings stress;
+    try
+    {
+        if (argc > 1)
+        {
+            if (std::string{argv[1]} != "--stress")
+                throw std::invalid_argument(argv[1]);
+            stress.enemies = argc > 2 ? std::stoul(argv[2]) : 1000;
+            stress.bullets = argc > 3 ? std::stoul(argv[3]) : 10000;
+        }
+    }
+    catch (const std::exception&)
+    {
+        std::cerr << "Usage: " << argv[0] << " [--stress [enemies] [bullets]]\n";
+        return 1;
+    }
+
+    Game game(stress);
     game.Start();
     return 0;
 }
\ No newline at end of file
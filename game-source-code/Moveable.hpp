@@ -40,7 +40,10 @@ enum MovementDirection
 ////////////////////////////////////////////////////////////
 /// \brief Moveable Class
 ///
-/// An abstract base class for game objects that can move or be transformed spatially
+/// A base class for game objects that can move or be transformed spatially.
+/// Holds the position state and its getters. The movement itself (setMove,
+/// move) is defined by each entity class, and is called on the concrete type:
+/// there are no virtual functions, so entities carry no vtable pointer
 ///
 /// \see Animatable
 /// \see PlayerShip
@@ -64,71 +67,17 @@ public:
              float angle,
              float scale) : _distanceFromCentre{distanceFromCentre},
                             _angle{angle},
-                            _scale{scale} {}
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Pure Virtual method to set the future movement, either by change in angle or change in distance
-    ///
-    /// Some entities only need a change in angle, or distance, not both.
-    /// The actual position of the entity is not altered until the move()
-    /// method is called, which performs the actual translation
-    ///
-    /// \param value The delta change in angle or distance (will be added to
-    /// the current angle/distance
-    ///
-    /// \see move
-    ////////////////////////////////////////////////////////////
-    virtual void setMove(float value)=0;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Pure Virtual method to set the future movement, by both angle and distance
-    ///
-    /// Some entities only need a change in angle and distance to move.
-    /// The actual position of the entity is not altered until the move()
-    /// method is called, which performs the actual translation
-    ///
-    /// \param angle The delta change in angle (will be added to
-    /// the current angle
-    /// \param distance The delta change in distance (will be added to
-    /// the current distance
-    ///
-    /// \see move
-    ////////////////////////////////////////////////////////////
-    virtual void setMove(float angle, float distance)=0;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Virtual method to set up the next frame's position for the object, with a different screen origin
-    ///
-    /// The actual position of the entity is not altered until the move()
-    /// method is called, which performs the actual translation
-    ///
-    /// \param angle The angle the entity should move for the next frame (0-360,
-    /// with 0 being the positive horizontal x axis, with the specified centre argument as the origin)
-    /// \param distance How far the entity should move for the next frame (in screen space)
-    /// \param centre The coordinate {x,y} to be considered as the origin for this move
-    ////////////////////////////////////////////////////////////
-    virtual void setMove(float angle, float distance, Vector2f centre) {}
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Sets the movement state of the entity
-    ///
-    /// \param movementState The enum value of the movement state.
-    ///
-    /// \see MovementDirection
-    ////////////////////////////////////////////////////////////
-    virtual void setMovementState(MovementState movementState) {}
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Pure virtual method definition for performing a move
-    ////////////////////////////////////////////////////////////
-    virtual void move()=0;
+                            _polarRadius{distanceFromCentre},
+                            _polarAngle{angle},
+                            _scale{scale},
+                            _screenScale{scale, scale} {}
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns current Movement state for the enemy
     ///
     /// \return An enum value of the current movement state
     ////////////////////////////////////////////////////////////
-    virtual const MovementState getMovementState() const
+    const MovementState getMovementState() const
     {return _movementState;}
 
     ////////////////////////////////////////////////////////////
@@ -137,43 +86,24 @@ public:
     /// \return An sf:Vector2f (two float values) of the {x,y} position
     /// considered the current origin of the entity
     ////////////////////////////////////////////////////////////
-    virtual const Vector2f getCentre() const
+    const Vector2f getCentre() const
     {return _centre;}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Virtual method to return the distance from origin (screen space)
-    ///
-    /// \return A float value, the distance from the origin (on camera plane)
-    ////////////////////////////////////////////////////////////
-    virtual const float getRadius() const=0;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Virtual method to return the distance from origin (non-linear distance)
-    ///
-    /// \return A float value, the depth from the centre in z
-    ////////////////////////////////////////////////////////////
-    virtual const float getDistanceFromCentre()const=0;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Virtual method to return the scale (in width/height) of the object
+    /// \brief Returns the scale (in width/height) of the object
     ///
     /// \return A Vector2f - two (float) values {x,y} of the scale in width and height
     ////////////////////////////////////////////////////////////
-    virtual const Vector2f getScale()const=0;
+    const Vector2f getScale() const
+    {return _screenScale;}
 
     ////////////////////////////////////////////////////////////
-    /// \brief Virtual method to return the x,y position of the object on screen
+    /// \brief Returns the x,y position of the object on screen
     ///
     /// \return A Vector2f - two (float) values {x,y} of the screen space coordinates of the object
     ////////////////////////////////////////////////////////////
-    virtual const Vector2f getPosition()const=0;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the current angle of the playerShip around the movement circle
-    ///
-    /// \return A float value, the angle around the perimeter circle
-    ////////////////////////////////////////////////////////////
-    virtual const float getAngle() const=0;
+    const Vector2f getPosition() const
+    {return _position;}
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns the currently set movement direction for the entity
@@ -181,7 +111,7 @@ public:
     /// \return An enum value of the current movement direction,
     /// clockwise or counterclockwise
     ////////////////////////////////////////////////////////////
-    virtual const int getMovementDirectionSign() const
+    const int getMovementDirectionSign() const
     {     // Swaps the direction of the angle increase
         switch (_movementDirection)
         {
@@ -221,6 +151,25 @@ protected:
     ////////////////////////////////////////////////////////////
     float _angle;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Data member storing the distance of the entity from the centre
+    /// of the screen (screen space). Together with _polarAngle, this is where
+    /// the entity is. Set on every move, so it is never derived back from the
+    /// screen position
+    ////////////////////////////////////////////////////////////
+    float _polarRadius;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Data member storing the angle of the entity around the centre of the screen
+    /// \see _polarRadius
+    ////////////////////////////////////////////////////////////
+    float _polarAngle;
+
+    ////////////////////////////////////////////////////////////
+    /// \param The current position of the entity on screen
+    ////////////////////////////////////////////////////////////
+    Vector2f _position;
+
     ////////////////////////////////////////////////////////////
     /// \param The last position of the entity on screen
     ////////////////////////////////////////////////////////////
@@ -241,6 +190,13 @@ protected:
     ////////////////////////////////////////////////////////////
     float _scale;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Data member storing the current on-screen scale {x,y}
+    /// (the _scale after perspective has been applied)
+    /// \see getScale
+    ////////////////////////////////////////////////////////////
+    Vector2f _screenScale;
+
     ////////////////////////////////////////////////////////////
     /// \brief Data member storing the boolean state of whether the object is moving or not
     ////////////////////////////////////////////////////////////
@@ -34,7 +34,7 @@ PerlinNoise::PerlinNoise(unsigned int seed) {
     permutationVector.insert(permutationVector.end(), permutationVector.begin(), permutationVector.end());
 }
 
-double PerlinNoise::noise(double x, double y , double z) {
+double PerlinNoise::noise(double x, double y , double z) const {
     // Find the unit cube that contains the point
     int X = (int) floor(x) & 255;
     int Y = (int) floor(y) & 255;
@@ -73,19 +73,19 @@ double PerlinNoise::noise(double x, double y , double z) {
     return (res + 1.0)/2.0;
 }
 
-double PerlinNoise::smootherStep(double t)
+double PerlinNoise::smootherStep(double t) const
 {
     return t * t * t * (t * (t * 6 - 15) + 10);
 }
 
-double PerlinNoise::lerp(double t, double a, double b)
+double PerlinNoise::lerp(double t, double a, double b) const
 {
 //    return a + t * (b - a); // Linear interpolation
     auto f = (1 - cos(t * M_PI)) * 0.5; // Ease in and out interpolation (cosine interpolation)
     return a * (1 - f) + b * f;
 }
 
-double PerlinNoise::grad(int hash, double x, double y, double z)
+double PerlinNoise::grad(int hash, double x, double y, double z) const
 {
     int h = hash & 15;
     // Convert lower 4 bits of hash into 12 gradient directions
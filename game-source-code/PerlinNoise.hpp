@@ -51,7 +51,7 @@ public:
     /// \param z Input for z coordinate (optional)
     /// \return A float value between 0 and 1, which varies smoothly around 0.5f
     ////////////////////////////////////////////////////////////
-    double noise(double x, double y = 0.f, double z = 0.f);
+    double noise(double x, double y = 0.f, double z = 0.f) const;
 
 private:
     ////////////////////////////////////////////////////////////
@@ -62,7 +62,7 @@ private:
     /// \param t The input value (treated as time)
     /// \see https://en.wikipedia.org/wiki/Smoothstep
     ////////////////////////////////////////////////////////////
-    double smootherStep(double t);
+    double smootherStep(double t) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Interpolates the input, using cosine interpolation
@@ -73,12 +73,12 @@ private:
     /// \return The interpolated value
     /// \see http://paulbourke.net/miscellaneous/interpolation/
     ////////////////////////////////////////////////////////////
-    double lerp(double t, double a, double b);
+    double lerp(double t, double a, double b) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Converts lower 4 bits of hash into 12 gradient directions
     ////////////////////////////////////////////////////////////
-    double grad(int hash, double x, double y = 0.f, double z = 0.f);
+    double grad(int hash, double x, double y = 0.f, double z = 0.f) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief The permutation vector, consisting of 256 unique integer values
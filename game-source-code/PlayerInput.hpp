@@ -0,0 +1,90 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   The player's controls, passed to the simulation thread
+///
+/// Window events can only be read on the thread that created the window,
+/// and the simulation runs on a thread of its own. The InputHandler writes
+/// the controls here, and the Simulation reads them once per step
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_PLAYERINPUT_HPP
+#define PROJECT_PLAYERINPUT_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <atomic>
+
+////////////////////////////////////////////////////////////
+/// \brief PlayerInput Class
+///
+/// The move is a speed, held until it is changed. Shots are counted, so a
+/// press of the fire button is never lost or repeated, however the presses
+/// fall between the steps. Both are atomic: one thread may write, and one
+/// other thread may read, without locking.
+///
+/// \see InputHandler
+/// \see Simulation
+////////////////////////////////////////////////////////////
+class PlayerInput
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor, with no move and no shots
+    ////////////////////////////////////////////////////////////
+    PlayerInput() : _move{0}, _shots{0}, _shotsTaken{0} {}
+
+    PlayerInput(const PlayerInput&) = delete;
+
+    PlayerInput &operator=(const PlayerInput&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sets the playerShip's move (input thread)
+    ///
+    /// \param move The move per second of game time, negative for anti-clockwise
+    ////////////////////////////////////////////////////////////
+    void setMove(float move)
+    {_move.store(move, std::memory_order_relaxed);}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Fires the playerShip's gun on the next step (input thread)
+    ////////////////////////////////////////////////////////////
+    void shoot()
+    {_shots.fetch_add(1, std::memory_order_relaxed);}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the playerShip's move per second of game time (simulation thread)
+    ////////////////////////////////////////////////////////////
+    float getMove() const
+    {return _move.load(std::memory_order_relaxed);}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Takes one shot that has not been fired yet (simulation thread)
+    ///
+    /// \return True if there was a shot to fire
+    ////////////////////////////////////////////////////////////
+    bool takeShot()
+    {
+        if (_shotsTaken == _shots.load(std::memory_order_relaxed))
+            return false;
+        _shotsTaken++;
+        return true;
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief The move per second of game time
+    ////////////////////////////////////////////////////////////
+    std::atomic<float> _move;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of presses of the fire button
+    ////////////////////////////////////////////////////////////
+    std::atomic<unsigned int> _shots;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of shots fired by the simulation
+    ////////////////////////////////////////////////////////////
+    unsigned int _shotsTaken;
+};
+
+#endif //PROJECT_PLAYERINPUT_HPP
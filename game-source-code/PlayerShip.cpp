@@ -11,13 +11,11 @@ PlayerShip::PlayerShip(const Vector2i resolution,
                        float distanceFromCentre,
                        float angle,
                        float scale,
-                       const entity::ID type,
-                       const TextureHolder &textureHolder) : Entity{resolution,
-                                                                    distanceFromCentre,
-                                                                    angle,
-                                                                    scale,
-                                                                    type,
-                                                                    textureHolder}
+                       const entity::ID type) : Entity{resolution,
+                                                       distanceFromCentre,
+                                                       angle,
+                                                       scale,
+                                                       type}
 {
     _lives = 3;
     _isUpgraded = false;
@@ -26,10 +24,7 @@ PlayerShip::PlayerShip(const Vector2i resolution,
     _animationFPSLimit = 0;
     _rectArea = {0, 0, 366, 382}; // Individual sprite tile
     _spriteOffset = _rectArea.width; // Animated sprite tile-set width
-    _sprite.setTexture(textureHolder.get(textures::PlayerShip));
-    _sprite.setTextureRect(_rectArea);
-    _sprite.setOrigin(_sprite.getGlobalBounds().width / 2, _sprite.getGlobalBounds().height / 2);
-    _sprite.setScale(_scale, _scale);
+    _id = textures::PlayerShip;
     _isInvulnerable = true;
     _isShooting = false;
     _isMoving = false;
@@ -50,8 +45,14 @@ void PlayerShip::reset()
     _isMoving = false;
     _isUpgraded = false;
     _isInvulnerable = true;
-    _invulnerabilityTimer.restart();
+    _ticksSinceRespawn = 0;
     setMove(0);
+
+    // Back at the starting point straight away, not on the next move
+    setPolarPosition(_distanceFromCentre, _angle);
+    _rotation = -1 * _angle;
+    updateCollisionCircle();
+    storePreviousState();
 }
 
 void PlayerShip::upgrade()
@@ -71,7 +72,6 @@ void PlayerShip::update()
             {
                 _rectArea.left = 0;
             }
-            _sprite.setTextureRect(_rectArea);
         }
         else
         {
@@ -83,7 +83,8 @@ void PlayerShip::update()
     {
         stopShoot();
     }
-    if (_invulnerabilityTimer.getElapsedTime().asSeconds() > _invulnerabilityTimeAmount)
+    _ticksSinceRespawn++;
+    if (SimulationClock::toSeconds(_ticksSinceRespawn) > _invulnerabilityTimeAmount)
     {
         _isInvulnerable = false;
     }
@@ -99,32 +100,8 @@ const float PlayerShip::getRadius() const
 
 const float PlayerShip::getDistanceFromCentre() const
 {
-    return _distanceFromCentre - _sprite.getGlobalBounds().height/2;
-}
-
-const Vector2f PlayerShip::getPosition() const
-{
-    return _sprite.getPosition();
-}
-
-const Sprite &PlayerShip::getSprite() const
-{
-    return _sprite;
-}
-
-const Vector2f PlayerShip::getScale() const
-{
-    return _sprite.getScale();
-}
-
-const int PlayerShip::getLives() const
-{
-    return _lives;
-}
-
-const entity::ID PlayerShip::getType() const
-{
-    return _type;
+    checkCachedKinematics();
+    return _distanceFromCentre - _boundsSize.y/2;
 }
 
 void PlayerShip::die()
@@ -139,11 +116,6 @@ void PlayerShip::setShoot()
     _isShooting = true;
 }
 
-const bool PlayerShip::isShooting() const
-{
-    return _isShooting;
-}
-
 const bool PlayerShip::isMoving() const
 {
     return _isMoving;
@@ -159,11 +131,6 @@ const bool PlayerShip::isUpgraded() const
     return _isUpgraded;
 }
 
-const bool PlayerShip::isAlive() const
-{
-    return _isAlive;
-}
-
 const float PlayerShip::getAngle() const
 {
     return _angle;
@@ -182,9 +149,9 @@ void PlayerShip::move()
     _angle = common::angleFilter(_angle);
 
     //Rotate coordinate system by 90 degrees
-    _sprite.setPosition(_distanceFromCentre * sin(common::degreeToRad(_angle)) + _resolution.x / 2,
-                        _distanceFromCentre * cos(common::degreeToRad(_angle)) + _resolution.y / 2);
-    _sprite.setRotation(-1 * _angle);
+    setPolarPosition(_distanceFromCentre, _angle);
+    _rotation = -1 * _angle;
+    updateCollisionCircle();
 }
 
 void PlayerShip::stopShoot()
@@ -192,7 +159,6 @@ void PlayerShip::stopShoot()
     _isShooting = false;
 }
 
-
 void PlayerShip::makeInvulnerable(bool invulnerability)
 {
     _isInvulnerable = invulnerability;
@@ -202,5 +168,3 @@ void PlayerShip::makeInvulnerable(bool invulnerability)
         _invulnerabilityTimeAmount = 1.2f;
 }
 
-
-
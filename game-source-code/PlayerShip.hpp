@@ -10,18 +10,13 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
-#include <SFML/Graphics.hpp>
-#include <SFML/Audio.hpp>
 #include <cmath>
 #include "common.hpp"
 #include "Entity.hpp"
-#include "ResourceHolder.hpp"
+#include "SimulationClock.hpp"
 
 using sf::Vector2f;
 using sf::Vector2i;
-using sf::Sprite;
-using sf::IntRect;
-using sf::Clock;
 
 ////////////////////////////////////////////////////////////
 /// \brief playerShip Class, inherited from Entity
@@ -34,7 +29,7 @@ using sf::Clock;
 ///
 /// \see Entity
 ////////////////////////////////////////////////////////////
-class PlayerShip : public Entity
+class PlayerShip final : public Entity
 {
 public:
     ////////////////////////////////////////////////////////////
@@ -48,19 +43,15 @@ public:
     /// \param scale The scale of the playerShip
     /// \param type An enum that identifies the Entity type. Defined in common.hpp,
     /// passed to the Animatable base class
-    /// \param textureHolder The resourceMapper object that
-    /// contains the path to the texture(s) for the sprite
     ///
     /// \see Entity
     /// \see common
-    /// \see ResourceHolder
     ////////////////////////////////////////////////////////////
     PlayerShip(const Vector2i resolution,
                float distanceFromCentre,
                float angle,
                float scale,
-               const entity::ID type,
-               const TextureHolder &textureHolder);
+               const entity::ID type);
 
     ////////////////////////////////////////////////////////////
     /// \brief Sets the future player movement, rotating the
@@ -74,31 +65,18 @@ public:
     ///
     /// \see move
     ////////////////////////////////////////////////////////////
-    void setMove(float angle) override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Sets the future movement, by both angle and distance
-    ///
-    ///
-    /// \param angle The delta change in angle (will be added to
-    /// the current angle
-    /// \param distance The delta change in distance (will be added to
-    /// the current distance
-    ///
-    /// \see move
-    ////////////////////////////////////////////////////////////
-    void setMove(float angle, float distance) override {};
+    void setMove(float angle);
 
     ////////////////////////////////////////////////////////////
     /// \brief Sets the _isShooting state of the playerShip
     ////////////////////////////////////////////////////////////
-    void setShoot() override;
+    void setShoot();
 
     ////////////////////////////////////////////////////////////
     /// \brief Moves the player ship around a circle by this angle,
     /// based on the futureAngleValue and futureMoveValue
     ////////////////////////////////////////////////////////////
-    void move() override;
+    void move();
 
     ////////////////////////////////////////////////////////////
     /// \brief Resets the player ship (intended to be called after
@@ -110,7 +88,7 @@ public:
     /// The various boolean states are reset to their default values.
     /// Any upgrades are lost, and these planned moves are immediately performed
     ////////////////////////////////////////////////////////////
-    void reset() override;
+    void reset();
 
     ////////////////////////////////////////////////////////////
     /// \brief Checks and updates the movement, shooting and calls
@@ -118,7 +96,7 @@ public:
     ///
     /// \see move
     ////////////////////////////////////////////////////////////
-    void update() override;
+    void update();
 
     ////////////////////////////////////////////////////////////
     /// \brief Sets the boolean state of the playerShip upgrade status to true.
@@ -131,68 +109,33 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Decrements the player lives
     ////////////////////////////////////////////////////////////
-    void die() override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the Sprite object of the Class by ref
-    ///
-    /// \return The sf::Sprite object representing the entity in the game
-    /// (dimensions, position, texture)
-    ///
-    /// \see sf:Sprite
-    ////////////////////////////////////////////////////////////
-    const Sprite &getSprite() const override;
+    void die();
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns the distance from origin (screen space)
     ///
+    /// Replaces Entity::getRadius: the ship's radius is measured to the
+    /// inner edge of its sprite, as with getDistanceFromCentre
+    ///
     /// \return A float value, the distance from the origin (on camera plane)
     ////////////////////////////////////////////////////////////
-    const float getRadius() const override; // As below
+    const float getRadius() const; // As below
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns the distance from origin (non-linear distance)
     ///
     /// \return A float value, the depth from the centre in z
     ////////////////////////////////////////////////////////////
-    const float getDistanceFromCentre() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the x,y position of the playership on screen
-    ///
-    /// \return A Vector2f - two (float) values {x,y} of the screen space coordinates of the object
-    ////////////////////////////////////////////////////////////
-    const Vector2f getPosition() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the scale (in width/height) of the playerShip object
-    ///
-    /// \return A Vector2f - two (float) values {x,y} of the scale in width and height
-    ////////////////////////////////////////////////////////////
-    const Vector2f getScale() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the remaining number of lives of the player
-    ///
-    /// \return The integer number of remaining lives
-    ////////////////////////////////////////////////////////////
-    const int getLives() const override;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Returns the entity type
-    ///
-    /// \return An enum value (defined in common.hpp) of the entity type
-    /// \see common
-    /// \see Entity
-    ////////////////////////////////////////////////////////////
-    const entity::ID  getType() const override;
+    const float getDistanceFromCentre() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns the current angle of the playerShip around the movement circle
     ///
+    /// Replaces Entity::getAngle, returning the ship's own angle along its path
+    ///
     /// \return A float value, the angle around the perimeter circle
     ////////////////////////////////////////////////////////////
-    const float getAngle() const override;
+    const float getAngle() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Returns the future, intended angle of the playerShip around the movement circle,
@@ -202,13 +145,6 @@ public:
     ////////////////////////////////////////////////////////////
     float getFutureAngle();
 
-    ////////////////////////////////////////////////////////////
-    /// \brief Boolean state of the playerShip (alive/dead)
-    ///
-    /// \return A boolean value of alive(1) or dead(0)
-    ////////////////////////////////////////////////////////////
-    const bool isAlive() const override;
-
     ////////////////////////////////////////////////////////////
     /// \brief Boolean movement state of the playerShip
     ///
@@ -216,13 +152,6 @@ public:
     ////////////////////////////////////////////////////////////
     const bool isMoving() const;
 
-    ////////////////////////////////////////////////////////////
-    /// \brief Boolean shooting state of the playerShip
-    ///
-    /// \return The boolean value of shooting(1) or not shooting(0)
-    ////////////////////////////////////////////////////////////
-    const bool isShooting() const override;
-
     ////////////////////////////////////////////////////////////
     /// \brief Boolean state of the playerShip taking damage from collisions or not
     ///
@@ -243,6 +172,14 @@ public:
     ////////////////////////////////////////////////////////////
     const bool isUpgraded() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the number of simulation steps since the playerShip respawned
+    ///
+    /// \return The steps counted by update() since the last reset()
+    ////////////////////////////////////////////////////////////
+    SimulationClock::Ticks getTicksSinceRespawn() const
+    {return _ticksSinceRespawn;}
+
     ////////////////////////////////////////////////////////////
     /// \brief Makes the playerShip unaffected by damage
     ///
@@ -257,12 +194,7 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief resets the _isShooting status to false.
     ////////////////////////////////////////////////////////////
-    void stopShoot() override;
-
-    ////////////////////////////////////////////////////////////
-    /// \param Boolean storing state of playerShip: moving or stationary
-    ////////////////////////////////////////////////////////////
-    bool _isShooting;
+    void stopShoot();
 
     ////////////////////////////////////////////////////////////
     /// \param Boolean storing state of playerShip: invulnerable or normal
@@ -275,9 +207,10 @@ private:
     bool _isUpgraded;
 
     ////////////////////////////////////////////////////////////
-    /// \param Timer for invulnerability
+    /// \param The number of simulation steps since the player respawned
+    /// (counted in update), timing the invulnerability
     ////////////////////////////////////////////////////////////
-    Clock _invulnerabilityTimer;
+    SimulationClock::Ticks _ticksSinceRespawn;
 
     ////////////////////////////////////////////////////////////
     /// \param How long the player is invulnerable for after respawning (in seconds)
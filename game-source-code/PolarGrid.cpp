@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Implementation of the polar spatial index
+/////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+#include "PolarGrid.hpp"
+
+PolarGrid::PolarGrid(Vector2f centre,
+                     float maxRadius,
+                     int bands,
+                     int sectors) : _centre{centre},
+                                    _bandWidth{maxRadius / bands},
+                                    _bands{bands},
+                                    _sectors{sectors},
+                                    _maxEntityRadius{0}
+{
+    _cellStart.resize(_bands * _sectors + 1);
+}
+
+void PolarGrid::clear()
+{
+    _entityCells.clear();
+    _entityIndices.clear();
+    _entityCircles.clear();
+    _maxEntityRadius = 0;
+}
+
+void PolarGrid::insert(unsigned int index, Vector2f position, float radius)
+{
+    auto offset = position - _centre;
+    auto distance = std::sqrt(offset.x * offset.x + offset.y * offset.y);
+    auto cell = band(distance) * _sectors + sector(std::atan2(offset.y, offset.x));
+    _entityCells.push_back(cell);
+    _entityIndices.push_back(index);
+    _entityCircles.push_back(position, radius);
+    _maxEntityRadius = std::max(_maxEntityRadius, radius);
+}
+
+void PolarGrid::build()
+{
+    // Counting sort of the entities by cell
+    std::fill(_cellStart.begin(), _cellStart.end(), 0);
+    for (auto cell : _entityCells)
+        _cellStart[cell + 1]++;
+    for (auto cell = 1u; cell < _cellStart.size(); cell++)
+        _cellStart[cell] += _cellStart[cell - 1];
+
+    auto entities = _entityIndices.size();
+    _sortedIndices.resize(entities);
+    _sortedCircles.x.resize(entities);
+    _sortedCircles.y.resize(entities);
+    _sortedCircles.radius.resize(entities);
+    _cellCursor.assign(_cellStart.begin(), _cellStart.end() - 1);
+    for (auto i = 0u; i < entities; i++)
+    {
+        auto slot = _cellCursor[_entityCells[i]]++;
+        _sortedIndices[slot] = _entityIndices[i];
+        _sortedCircles.x[slot] = _entityCircles.x[i];
+        _sortedCircles.y[slot] = _entityCircles.y[i];
+        _sortedCircles.radius[slot] = _entityCircles.radius[i];
+    }
+}
+
+void PolarGrid::queryRanges(Vector2f position,
+                            float radius,
+                            std::vector<range> &ranges) const
+{
+    ranges.clear();
+    if (_entityIndices.empty()) return;
+
+    // Any entity that can touch the circle has its centre within this distance
+    auto reach = radius + _maxEntityRadius;
+    auto offset = position - _centre;
+    auto distance = std::sqrt(offset.x * offset.x + offset.y * offset.y);
+    auto firstBand = band(std::max(0.f, distance - reach));
+    auto lastBand = band(distance + reach);
+
+    // Angular half-width of the circle as seen from the centre. If the circle
+    // covers the centre, every sector is within reach
+    auto firstSector = 0;
+    auto numberOfSectors = _sectors;
+    if (distance > reach)
+    {
+        auto angle = std::atan2(offset.y, offset.x);
+        auto halfWidth = std::asin(reach / distance);
+        firstSector = sector(angle - halfWidth);
+        numberOfSectors = std::min(_sectors,
+                                   (sector(angle + halfWidth) - firstSector + _sectors) % _sectors + 1);
+    }
+
+    for (auto bandIndex = firstBand; bandIndex <= lastBand; bandIndex++)
+    {
+        for (auto i = 0; i < numberOfSectors; i++)
+        {
+            auto cell = bandIndex * _sectors + (firstSector + i) % _sectors;
+            auto begin = _cellStart[cell];
+            auto end = _cellStart[cell + 1];
+            if (begin == end) continue;
+
+            // Cells next to each other in the sort are one run
+            if (!ranges.empty() && ranges.back().end == begin)
+                ranges.back().end = end;
+            else
+                ranges.push_back({begin, end});
+        }
+    }
+}
+
+int PolarGrid::band(float distance) const
+{
+    return std::min(static_cast<int>(distance / _bandWidth), _bands - 1);
+}
+
+int PolarGrid::sector(float angle) const
+{
+    const auto twoPi = static_cast<float>(2 * M_PI);
+    auto turns = (angle + static_cast<float>(M_PI)) / twoPi;
+    auto index = static_cast<int>(std::floor(turns * _sectors)) % _sectors;
+    return index < 0 ? index + _sectors : index;
+}
@@ -0,0 +1,188 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Polar spatial index, used as a collision broad-phase
+///
+/// Everything in the game moves on rings around the centre of the screen,
+/// so entities are bucketed by radius band and angle sector
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_POLARGRID_HPP
+#define PROJECT_POLARGRID_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include <SFML/System.hpp>
+#include "CollisionKernel.hpp"
+
+using sf::Vector2f;
+
+////////////////////////////////////////////////////////////
+/// \brief PolarGrid Class
+///
+/// Divides the screen into rings (radius bands) around the centre, and each
+/// ring into sectors of equal angle. Entities are inserted by their index in
+/// their owner's array, with their screen position and collision radius.
+/// After build(), queryRanges() returns the entities in the cells that a
+/// circle could overlap, so only those need the exact collision test.
+///
+/// The collision circles are kept sorted by cell, so the entities in
+/// neighbouring cells sit next to each other in flat arrays, and a query
+/// returns runs of these arrays, for testing with collision::overlapMask.
+///
+/// The grid is rebuilt every frame. Its arrays keep their memory between
+/// frames, so rebuilding does not allocate once the game is running.
+///
+/// \see EntityController
+/// \see collision::overlapMask
+////////////////////////////////////////////////////////////
+class PolarGrid
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief A run of entities in the sorted circle arrays, [begin, end)
+    ////////////////////////////////////////////////////////////
+    struct range
+    {
+        unsigned int begin;
+        unsigned int end;
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor for the PolarGrid
+    ///
+    /// \param centre The screen coordinate {x,y} that is the origin of the rings
+    /// \param maxRadius The outer radius of the last band (entities further out are put in the last band)
+    /// \param bands The number of radius bands
+    /// \param sectors The number of angle sectors in each band
+    ////////////////////////////////////////////////////////////
+    PolarGrid(Vector2f centre,
+              float maxRadius,
+              int bands = 16,
+              int sectors = 32);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Removes all entities from the grid
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Adds an entity to the grid
+    ///
+    /// \param index The entity's index in its owner's array
+    /// \param position The entity's position on screen
+    /// \param radius The entity's collision radius
+    ////////////////////////////////////////////////////////////
+    void insert(unsigned int index, Vector2f position, float radius);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sorts the inserted entities into their cells. Must be called
+    /// after the last insert() and before queryRanges()
+    ////////////////////////////////////////////////////////////
+    void build();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Finds the entities that might overlap a circle, as runs of the
+    /// sorted circle arrays (neighbouring cells are merged into one run)
+    ///
+    /// \param position The centre of the circle on screen
+    /// \param radius The radius of the circle
+    /// \param ranges Filled with the runs of entities in every cell the circle
+    /// could touch (each entity in at most one run). Cleared first
+    ///
+    /// \see getSortedCircles
+    /// \see getSortedIndex
+    ////////////////////////////////////////////////////////////
+    void queryRanges(Vector2f position,
+                     float radius,
+                     std::vector<range> &ranges) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the collision circles of the entities, sorted by cell
+    ////////////////////////////////////////////////////////////
+    const collision::CircleArray &getSortedCircles() const
+    {return _sortedCircles;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the entity index (as inserted) at a position in the sorted arrays
+    ////////////////////////////////////////////////////////////
+    unsigned int getSortedIndex(unsigned int position) const
+    {return _sortedIndices[position];}
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the radius band for a distance from the centre
+    ////////////////////////////////////////////////////////////
+    int band(float distance) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the angle sector for an angle (in radians, -pi to pi)
+    ////////////////////////////////////////////////////////////
+    int sector(float angle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The origin of the rings
+    ////////////////////////////////////////////////////////////
+    Vector2f _centre;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The width of each radius band (in pixels)
+    ////////////////////////////////////////////////////////////
+    float _bandWidth;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of radius bands
+    ////////////////////////////////////////////////////////////
+    int _bands;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of angle sectors per band
+    ////////////////////////////////////////////////////////////
+    int _sectors;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The largest collision radius inserted since the last clear()
+    ///
+    /// Queries are widened by this amount, so an entity only needs to be
+    /// stored in the cell containing its centre
+    ////////////////////////////////////////////////////////////
+    float _maxEntityRadius;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The cell of each inserted entity, in insertion order
+    ////////////////////////////////////////////////////////////
+    std::vector<unsigned int> _entityCells;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The index of each inserted entity, in insertion order
+    ////////////////////////////////////////////////////////////
+    std::vector<unsigned int> _entityIndices;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The collision circle of each inserted entity, in insertion order
+    ////////////////////////////////////////////////////////////
+    collision::CircleArray _entityCircles;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief For each cell, where its entities start in _sortedIndices
+    /// (one extra element marks the end of the last cell)
+    ////////////////////////////////////////////////////////////
+    std::vector<unsigned int> _cellStart;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The entity indices, sorted by cell
+    ////////////////////////////////////////////////////////////
+    std::vector<unsigned int> _sortedIndices;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The collision circles, sorted by cell (in the same order as _sortedIndices)
+    ////////////////////////////////////////////////////////////
+    collision::CircleArray _sortedCircles;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The next free slot in each cell, while building
+    ////////////////////////////////////////////////////////////
+    std::vector<unsigned int> _cellCursor;
+};
+
+#endif //PROJECT_POLARGRID_HPP
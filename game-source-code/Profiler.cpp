@@ -0,0 +1,77 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Times each phase of the game loop, keeping a recent history
+/////////////////////////////////////////////////////////////////////
+
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+
+Profiler::Profiler(std::size_t history) : _history{std::max<std::size_t>(1, history)},
+                                          _timings(_history * NumberOfPhases, 0.f),
+                                          _recorded(NumberOfPhases, 0)
+{}
+
+void Profiler::record(Phase phase, float microseconds)
+{
+    _timings[phase * _history + _recorded[phase] % _history] = microseconds;
+    _recorded[phase]++;
+}
+
+PhaseStatistics Profiler::getStatistics(Phase phase) const
+{
+    auto samples = std::min(_recorded[phase], _history);
+    if (samples == 0)
+        return PhaseStatistics{0, 0, 0, 0};
+
+    // Sorted on a copy, so that reading does not disturb the history
+    auto first = _timings.begin() + phase * _history;
+    std::vector<float> timings(first, first + samples);
+    auto rank = static_cast<std::size_t>(std::ceil(samples * 0.99)) - 1;
+    std::nth_element(timings.begin(), timings.begin() + rank, timings.end());
+
+    PhaseStatistics statistics;
+    statistics.samples = samples;
+    statistics.minimum = *std::min_element(timings.begin(), timings.end());
+    statistics.mean = std::accumulate(timings.begin(), timings.end(), 0.f) / samples;
+    statistics.percentile99 = timings[rank];
+    return statistics;
+}
+
+void Profiler::report(std::ostream &output) const
+{
+    auto flags = output.flags();
+    output << std::fixed << std::setprecision(1);
+    for (auto phase = 0; phase < NumberOfPhases; phase++)
+    {
+        auto statistics = getStatistics(static_cast<Phase>(phase));
+        if (statistics.samples == 0)
+            continue;
+
+        output << std::left << std::setw(18) << getName(static_cast<Phase>(phase)) << std::right
+               << " min " << std::setw(8) << statistics.minimum
+               << " us  avg " << std::setw(8) << statistics.mean
+               << " us  p99 " << std::setw(8) << statistics.percentile99
+               << " us  (" << statistics.samples << " samples)\n";
+    }
+    output.flags(flags);
+}
+
+const char *Profiler::getName(Phase phase)
+{
+    switch (phase)
+    {
+        case SpawnEntities : return "spawnEntities";
+        case SetMove : return "setMove";
+        case SetPlayerShipMove : return "setPlayerShipMove";
+        case Shoot : return "shoot";
+        case CheckClipping : return "checkClipping";
+        case CheckCollisions : return "checkCollisions";
+        case Update : return "update";
+        case PlayEventSounds : return "playEventSounds";
+        case Render : return "render";
+        case Display : return "display";
+        default : return "unknown";
+    }
+}
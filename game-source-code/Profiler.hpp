@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Times each phase of the game loop, keeping a recent history
+///
+/// Scoped timers around each phase record how long it took into a fixed
+/// size ring buffer per phase, so the minimum, mean and 99th percentile
+/// of the last few seconds are always to hand, without allocating while
+/// the game runs
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_PROFILER_HPP
+#define PROJECT_PROFILER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+////////////////////////////////////////////////////////////
+/// \brief The statistics of one phase over the recorded history
+////////////////////////////////////////////////////////////
+struct PhaseStatistics
+{
+    std::size_t samples;        /*!< The number of timings in the history */
+    float minimum;              /*!< The quickest, in microseconds */
+    float mean;                 /*!< The mean, in microseconds */
+    float percentile99;         /*!< 99% of the timings were no slower, in microseconds */
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Profiler Class
+///
+/// Each thread keeps its own Profiler (the Simulation times the phases of
+/// a step, the Game the phases of a frame), so recording needs no locking.
+/// A Profiler may only be read on the thread recording into it, or once
+/// that thread has finished.
+///
+/// \see Simulation
+/// \see Game
+////////////////////////////////////////////////////////////
+class Profiler
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief The timed phases of a step and of a frame
+    ////////////////////////////////////////////////////////////
+    enum Phase
+    {
+        SpawnEntities,      /*!< EntityController::spawnEntities */
+        SetMove,            /*!< EntityController::setMove */
+        SetPlayerShipMove,  /*!< PlayerShip::setMove */
+        Shoot,              /*!< EntityController::shoot */
+        CheckClipping,      /*!< EntityController::checkClipping */
+        CheckCollisions,    /*!< EntityController::checkCollisions */
+        Update,             /*!< Updating the score, playerShip and entities */
+        PlayEventSounds,    /*!< Game::playEventSounds */
+        Render,             /*!< Drawing a frame */
+        Display,            /*!< Showing the drawn frame */
+        NumberOfPhases
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Times the lifetime of the object, recording it as one
+    /// timing of a phase
+    ////////////////////////////////////////////////////////////
+    class Scope
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Starts timing a phase
+        ///
+        /// \param profiler The profiler to record the timing in
+        /// \param phase The phase being timed
+        ////////////////////////////////////////////////////////////
+        Scope(Profiler &profiler, Phase phase) : _profiler(profiler),
+                                                 _phase{phase},
+                                                 _start{std::chrono::steady_clock::now()}
+        {}
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Stops timing the phase, and records the timing
+        ////////////////////////////////////////////////////////////
+        ~Scope()
+        {
+            std::chrono::duration<float, std::micro> elapsed = std::chrono::steady_clock::now() - _start;
+            _profiler.record(_phase, elapsed.count());
+        }
+
+        Scope(const Scope&) = delete;
+
+        Scope &operator=(const Scope&) = delete;
+
+    private:
+        Profiler &_profiler;
+        Phase _phase;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param history The number of timings kept per phase, the oldest
+    /// being overwritten (10 seconds of steps by default)
+    ////////////////////////////////////////////////////////////
+    explicit Profiler(std::size_t history = 600);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Records one timing of a phase
+    ///
+    /// \param phase The phase that was timed
+    /// \param microseconds How long it took
+    ////////////////////////////////////////////////////////////
+    void record(Phase phase, float microseconds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the statistics of a phase over the recorded history
+    ///
+    /// \param phase The phase
+    /// \return The statistics, all zero if the phase has not been timed
+    ////////////////////////////////////////////////////////////
+    PhaseStatistics getStatistics(Phase phase) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Writes a line of statistics for each phase that has been timed
+    ///
+    /// \param output The stream to write the report to
+    ////////////////////////////////////////////////////////////
+    void report(std::ostream &output) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the name of a phase, as used in the report
+    ///
+    /// \param phase The phase
+    ////////////////////////////////////////////////////////////
+    static const char *getName(Phase phase);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of timings kept per phase
+    ////////////////////////////////////////////////////////////
+    std::size_t _history;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The ring buffer of each phase, one after the other
+    ////////////////////////////////////////////////////////////
+    std::vector<float> _timings;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of timings ever recorded for each phase. Modulo
+    /// the history, the slot the next timing goes in
+    ////////////////////////////////////////////////////////////
+    std::vector<std::size_t> _recorded;
+};
+
+#endif //PROJECT_PROFILER_HPP
@@ -0,0 +1,120 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Seedable, counter-based random number stream
+///
+/// Replaces the global rand()/srand() state, so that a game (and every
+/// entity in it) produces a repeatable sequence of random values
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_RANDOM_HPP
+#define PROJECT_RANDOM_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstdint>
+
+////////////////////////////////////////////////////////////
+/// \brief Random Class
+///
+/// A counter-based generator: the n-th value of a stream is a hash (the
+/// SplitMix64 finaliser) of the stream key and n. There is no hidden shared
+/// state, so separate games can run on separate threads, and a stream can be
+/// cheaply split into independent substreams (one per spawned entity).
+///
+/// Each Random object is a small value type, copied into its owner.
+/// Copies continue the same sequence independently.
+///
+/// \see EntityController
+/// \see Enemy
+/// \see Explosion
+/// \see StarField
+////////////////////////////////////////////////////////////
+class Random
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor for a random stream
+    ///
+    /// \param seed The seed for the stream. The same seed always
+    /// produces the same sequence of values
+    ////////////////////////////////////////////////////////////
+    explicit Random(std::uint64_t seed = 127) : _key{mix(seed)}, _counter{0} {}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Creates an independent stream derived from this one
+    ///
+    /// The substream only depends on this stream's seed and the streamID,
+    /// not on how many values have already been drawn
+    ///
+    /// \param streamID Identifies the substream (e.g. a spawn count)
+    /// \return A new Random object, starting at the beginning of the substream
+    ////////////////////////////////////////////////////////////
+    Random substream(std::uint64_t streamID) const
+    {
+        Random stream;
+        stream._key = mix(_key ^ mix(streamID + _golden));
+        return stream;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the next 64 random bits in the stream
+    ////////////////////////////////////////////////////////////
+    std::uint64_t next()
+    {return mix(_key + (++_counter) * _golden);}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns a random integer in the range [0, bound)
+    ///
+    /// Replaces rand() % bound
+    ///
+    /// \param bound The (exclusive) upper limit, must be greater than 0
+    ////////////////////////////////////////////////////////////
+    int nextInt(int bound)
+    {return static_cast<int>(((next() >> 32) * static_cast<std::uint64_t>(bound)) >> 32);}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns a random float in the range [0, 1)
+    ////////////////////////////////////////////////////////////
+    float nextFloat()
+    {return (next() >> 40) * (1.f / 16777216.f);}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns a random float in the range [min, max)
+    ///
+    /// \param min The lower limit
+    /// \param max The upper limit
+    ////////////////////////////////////////////////////////////
+    float nextFloat(float min, float max)
+    {return min + nextFloat() * (max - min);}
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief The SplitMix64 finaliser, a fast 64-bit hash with good avalanche
+    ///
+    /// \param value The value to hash
+    /// \return The hashed value
+    ////////////////////////////////////////////////////////////
+    static std::uint64_t mix(std::uint64_t value)
+    {
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The golden ratio increment, spreads consecutive counters apart
+    ////////////////////////////////////////////////////////////
+    static constexpr std::uint64_t _golden = 0x9e3779b97f4a7c15ULL;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The hashed seed identifying the stream
+    ////////////////////////////////////////////////////////////
+    std::uint64_t _key;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of values drawn from the stream so far
+    ////////////////////////////////////////////////////////////
+    std::uint64_t _counter;
+};
+
+#endif //PROJECT_RANDOM_HPP
@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Everything needed to draw one step of the game
+///
+/// The simulation runs on its own thread. After each batch of steps it
+/// copies the drawable state of the game into a RenderSnapshot, which the
+/// render thread reads without touching any entity
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_RENDERSNAPSHOT_HPP
+#define PROJECT_RENDERSNAPSHOT_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+#include "common.hpp"
+#include "FastMath.hpp"
+#include "Entity.hpp"
+#include "SimulationClock.hpp"
+
+////////////////////////////////////////////////////////////
+/// \brief The drawable state of one entity, at the previous and current step
+///
+/// \see RenderSnapshot
+/// \see EntityRenderer
+////////////////////////////////////////////////////////////
+struct SpriteState
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor, for an empty snapshot
+    ////////////////////////////////////////////////////////////
+    SpriteState() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copies the drawable state of an entity
+    ///
+    /// \param entity The entity to copy
+    ////////////////////////////////////////////////////////////
+    explicit SpriteState(const Entity &entity) : texture{entity.getTextureID()},
+                                                 frame(entity.getTextureRect()),
+                                                 colour(entity.getColour()),
+                                                 previousPosition{entity.getInterpolatedPosition(0)},
+                                                 position{entity.getPosition()},
+                                                 previousScale{entity.getInterpolatedScale(0)},
+                                                 scale{entity.getScale()},
+                                                 previousRotation{entity.getInterpolatedRotation(0)},
+                                                 rotation{entity.getRotation()}
+    {}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the screen position between the previous and current step
+    ///
+    /// \param interpolation How far from the previous (0) to the current (1) state
+    /// \see Entity::getInterpolatedPosition
+    ////////////////////////////////////////////////////////////
+    const Vector2f getInterpolatedPosition(float interpolation) const
+    {return previousPosition + (position - previousPosition) * interpolation;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the scale between the previous and current step
+    ///
+    /// \param interpolation How far from the previous (0) to the current (1) state
+    ////////////////////////////////////////////////////////////
+    const Vector2f getInterpolatedScale(float interpolation) const
+    {return previousScale + (scale - previousScale) * interpolation;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the rotation between the previous and current step,
+    /// turning the short way round
+    ///
+    /// \param interpolation How far from the previous (0) to the current (1) state
+    ////////////////////////////////////////////////////////////
+    const float getInterpolatedRotation(float interpolation) const
+    {
+        auto turn = fastmath::wrapDegrees(rotation - previousRotation + 180) - 180;
+        return previousRotation + turn * interpolation;
+    }
+
+    textures::ID texture;           /*!< The texture to draw from */
+    common::rect frame;             /*!< The area of the texture to draw */
+    common::colour colour;          /*!< The colour to tint the texture with */
+    Vector2f previousPosition;      /*!< Screen position at the previous step */
+    Vector2f position;              /*!< Screen position at the current step */
+    Vector2f previousScale;         /*!< Scale at the previous step */
+    Vector2f scale;                 /*!< Scale at the current step */
+    float previousRotation;         /*!< Rotation in degrees at the previous step */
+    float rotation;                 /*!< Rotation in degrees at the current step */
+};
+
+////////////////////////////////////////////////////////////
+/// \brief RenderSnapshot struct
+///
+/// The sprites to draw (in drawing order), the playerShip, the HUD values,
+/// and running counts of the events that trigger sounds. The counts only
+/// ever go up, so the render thread can tell that an event happened even if
+/// it skipped the snapshot it happened in.
+///
+/// Snapshots are passed between the threads by a TripleBuffer and reused,
+/// so clear() keeps the memory of the sprite list.
+///
+/// \see Simulation
+/// \see TripleBuffer
+////////////////////////////////////////////////////////////
+struct RenderSnapshot
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Removes all the sprites, keeping their memory
+    ////////////////////////////////////////////////////////////
+    void clear()
+    {sprites.clear();}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Adds every entity in a list to the sprites
+    ///
+    /// \param entities A vector or EntityPool of entities
+    ////////////////////////////////////////////////////////////
+    template <typename EntityList>
+    void add(const EntityList &entities)
+    {
+        for (const auto &entity : entities)
+            sprites.emplace_back(entity);
+    }
+
+    std::vector<SpriteState> sprites;       /*!< Every entity except the playerShip, in drawing order */
+    SpriteState playerShip;                 /*!< The playerShip, drawn after the other sprites */
+
+    int lives = 0;                          /*!< The playerShip's remaining lives */
+    bool isInvulnerable = false;            /*!< True if the playerShip is shielded */
+    bool isUpgraded = false;                /*!< True if the playerShip has the double shot */
+    float playerFutureAngle = 0;            /*!< The playerShip's move this step, which sets the engine pitch */
+    SimulationClock::Ticks ticksSinceRespawn = 0; /*!< Steps since the playerShip last respawned */
+
+    unsigned int score = 0;                 /*!< The current score */
+    unsigned int enemiesKilled = 0;         /*!< The number of enemies killed */
+    float timeAlive = 0;                    /*!< Game time since the playerShip last died, in seconds */
+    float speed = 0;                        /*!< The global game speed, which sets the starField speed */
+
+    unsigned int playerShots = 0;           /*!< Steps in which the playerShip shot */
+    unsigned int enemyShots = 0;            /*!< Steps in which an enemy shot */
+    unsigned int explosions = 0;            /*!< Steps in which something exploded */
+    unsigned int playerDeaths = 0;          /*!< Times the playerShip has died */
+
+    game::GameState gameState = game::GameState::Playing; /*!< Playing, or the game outcome once it is over */
+    SimulationClock::Ticks ticks = 0;       /*!< The step the snapshot was taken at */
+    float stepTime = 0;                     /*!< Real time at which the step was due, in seconds */
+};
+
+#endif //PROJECT_RENDERSNAPSHOT_HPP
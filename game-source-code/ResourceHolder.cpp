@@ -0,0 +1,94 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Packs the gameplay textures into atlas pages
+/////////////////////////////////////////////////////////////////////
+
+#include "ResourceHolder.hpp"
+#include <algorithm>
+
+void TextureHolder::packAtlas(const std::vector<textures::ID> &ids, unsigned int maximumPageSize)
+{
+    _atlasPages.clear();
+    _regions.clear();
+    auto pageSize = static_cast<int>(std::min(maximumPageSize, sf::Texture::getMaximumSize()));
+    const auto padding = 1;
+
+    // Tallest first, so that the textures sharing a shelf are of similar height
+    std::vector<textures::ID> packed;
+    for (auto id : ids)
+    {
+        auto size = get(id).getSize();
+        if (static_cast<int>(size.x) <= pageSize && static_cast<int>(size.y) <= pageSize)
+            packed.push_back(id);
+    }
+    std::stable_sort(packed.begin(), packed.end(), [this](textures::ID a, textures::ID b)
+    {
+        return get(a).getSize().y > get(b).getSize().y;
+    });
+
+    // Place each texture along the current shelf, starting a new shelf when
+    // it is full, and a new page when there is no room for another shelf
+    struct Placement
+    {
+        textures::ID id;
+        std::size_t page;
+        sf::IntRect rect;
+    };
+    std::vector<Placement> placements;
+    std::vector<sf::Vector2i> pageExtents;
+    auto x = 0, y = 0, shelfHeight = 0;
+    for (auto id : packed)
+    {
+        auto size = sf::Vector2i(get(id).getSize());
+        if (x + size.x > pageSize)
+        {
+            x = 0;
+            y += shelfHeight + padding;
+            shelfHeight = 0;
+        }
+        if (pageExtents.empty() || y + size.y > pageSize)
+        {
+            pageExtents.emplace_back(0, 0);
+            x = y = shelfHeight = 0;
+        }
+
+        auto &extent = pageExtents.back();
+        placements.push_back({id, pageExtents.size() - 1, {x, y, size.x, size.y}});
+        extent.x = std::max(extent.x, x + size.x);
+        extent.y = std::max(extent.y, y + size.y);
+        x += size.x + padding;
+        shelfHeight = std::max(shelfHeight, size.y);
+    }
+
+    // Each page is only as large as the shelves placed on it
+    for (auto page = 0u; page < pageExtents.size(); page++)
+    {
+        sf::Image image;
+        image.create(pageExtents[page].x, pageExtents[page].y, sf::Color::Transparent);
+        for (const auto &placement : placements)
+        {
+            if (placement.page == page)
+                image.copy(get(placement.id).copyToImage(), placement.rect.left, placement.rect.top);
+        }
+
+        std::unique_ptr<sf::Texture> texture(new sf::Texture());
+        if (!texture->loadFromImage(image))
+        {
+            throw std::runtime_error("TextureHolder::packAtlas - Failed to create an atlas page");
+        }
+        _atlasPages.push_back(move(texture));
+    }
+
+    for (const auto &placement : placements)
+        _regions[placement.id] = TextureRegion{_atlasPages[placement.page].get(), placement.rect};
+}
+
+TextureRegion TextureHolder::getRegion(textures::ID id) const
+{
+    auto found = _regions.find(id);
+    if (found != _regions.end())
+        return found->second;
+
+    const auto &texture = get(id);
+    auto size = sf::Vector2i(texture.getSize());
+    return TextureRegion{&texture, {0, 0, size.x, size.y}};
+}
@@ -14,9 +14,11 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics.hpp"
+#include "SFML/Audio/SoundBuffer.hpp"
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
 #include <cassert>
 #include "common.hpp"
 
@@ -29,7 +31,7 @@ using std::move;
 ///
 /// A mechanism to load all game art resources (textures, sounds and fonts) from disk,
 /// and to transfer the ownership of the unique_ptr to the object calling get()
-/// Several specific types are declared in common.hpp, TextureHolder, FontHolder and SoundHolder
+/// Several specific types are declared below, TextureHolder, FontHolder and SoundHolder
 ///
 /// \see common
 ////////////////////////////////////////////////////////////
@@ -89,4 +91,79 @@ private:
 // Template classes need to be defined inline
 #include "ResourceHolder.inl"
 
+////////////////////////////////////////////////////////////
+/// \brief An area of a texture: a whole texture, or its place in an atlas page
+///
+/// \see TextureHolder::getRegion
+////////////////////////////////////////////////////////////
+struct TextureRegion
+{
+    const sf::Texture *texture;     /*!< The texture to draw from */
+    sf::IntRect rect;               /*!< The area of that texture holding the image, in pixels */
+};
+
+////////////////////////////////////////////////////////////
+/// \brief The TextureHolder class
+///
+/// A ResourceHolder for textures, which can also pack the gameplay textures
+/// into atlas pages. Sprites drawn from one page can share a draw call
+/// (see SpriteBatch), where each texture of its own would need a call of its own.
+///
+/// The textures are still held as loaded, so get() is unchanged. The atlas
+/// is used through getRegion(), which gives the page and the area of it
+/// holding a texture. Frames of an animated tile-set stay addressed from the
+/// top-left of the tile-set, and are offset by the region's position.
+///
+/// \see EntityRenderer
+/// \see Shield
+////////////////////////////////////////////////////////////
+class TextureHolder : public ResourceHolder<sf::Texture, textures::ID>
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Copies loaded textures into as few atlas pages as they fit in
+    ///
+    /// The textures are placed in rows (shelves), tallest first, with a pixel
+    /// of space between them so that neighbours do not bleed into each other.
+    /// A texture too large for a page is left out, and is drawn from its own
+    /// texture. Packing again replaces the previous atlas.
+    ///
+    /// Needs a graphics context, as the images are copied on the graphics card
+    ///
+    /// \param ids The textures to pack (they must have been loaded)
+    /// \param maximumPageSize The largest width and height of a page, in pixels.
+    /// It is limited to the largest texture the graphics card supports
+    ////////////////////////////////////////////////////////////
+    void packAtlas(const std::vector<textures::ID> &ids, unsigned int maximumPageSize = 4096);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns where to draw a texture from
+    ///
+    /// \param id The texture ID
+    /// \return Its area of an atlas page, if it was packed, otherwise the
+    /// whole of the texture
+    ////////////////////////////////////////////////////////////
+    TextureRegion getRegion(textures::ID id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the number of atlas pages made by packAtlas()
+    ////////////////////////////////////////////////////////////
+    std::size_t getAtlasPageCount() const
+    {return _atlasPages.size();}
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief The atlas pages (unique pointers, so that regions keep valid addresses)
+    ////////////////////////////////////////////////////////////
+    std::vector<unique_ptr<sf::Texture>> _atlasPages;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The region of each packed texture
+    ////////////////////////////////////////////////////////////
+    std::map<textures::ID, TextureRegion> _regions;
+};
+
+typedef ResourceHolder<sf::SoundBuffer, sounds::ID> SoundHolder;
+typedef ResourceHolder<sf::Font, fonts::ID> FontHolder;
+
 #endif //PROJECT_RESOURCEMAPPER_H
\ No newline at end of file
@@ -4,10 +4,16 @@
 
 #include "Score.hpp"
 
+Score::Score(const SimulationClock &clock) : _lifeTimer{clock},
+                                             _updateTimer{clock}
+{
+    reset();
+}
+
 void Score::update()
 {
     auto survivalTimeIncrement = 1.f;
-    _survivalTime = _updateTimer.getElapsedTime().asSeconds();
+    _survivalTime = _updateTimer.getElapsedTime();
 
     if (_survivalTime > survivalTimeIncrement)
     {
@@ -93,7 +99,7 @@ const unsigned int Score::getBulletsFired() const
 
 const float Score::getTimeAlive() const
 {
-    return _lifeTimer.getElapsedTime().asSeconds();
+    return _lifeTimer.getElapsedTime();
 }
 
 const float Score::getLongestTimeAlive() const
@@ -103,7 +109,7 @@ const float Score::getLongestTimeAlive() const
 
 const void Score::resetLifeTimer()
 {
-    auto currentTimeAlive = _lifeTimer.getElapsedTime().asSeconds();
+    auto currentTimeAlive = _lifeTimer.getElapsedTime();
     if (currentTimeAlive > _longestTimeAlive)
     {
         _longestTimeAlive = currentTimeAlive;
@@ -6,6 +6,7 @@
 #define PROJECT_SCORE_HPP
 
 #include "common.hpp"
+#include "SimulationClock.hpp"
 
 ////////////////////////////////////////////////////////////
 /// \brief Score class, to store and calculate all player game scores.
@@ -13,6 +14,16 @@
 class Score
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Score class constructor. The life and survival bonus timers
+    /// measure game time on the simulation clock
+    ///
+    /// \param clock The game's simulation clock (must outlive the Score)
+    ///
+    /// \see SimulationClock
+    ////////////////////////////////////////////////////////////
+    explicit Score(const SimulationClock &clock);
+
     ////////////////////////////////////////////////////////////
     /// \brief When the player kills an enemy, this methos is called with the defined entity type.
     /// Based on the type of entity, different scores are given to the player. these scores are stored.
@@ -75,7 +86,8 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Accessor to return the time alive for the current player life
     ///
-    /// \return sf::Clock _lifeTimer, the current player life length
+    /// \return The game time, in seconds, since the last resetLifeTimer()
+    /// (the current player life length)
     ////////////////////////////////////////////////////////////
     const float getTimeAlive() const;
 
@@ -126,16 +138,16 @@ private:
     unsigned int _bulletsHit;
 
     ////////////////////////////////////////////////////////////
-    /// \brief sf::Clock to store the length of the current player life
+    /// \brief Timer to store the length of the current player life
     ///
     /// \see getTimeAlive
     ////////////////////////////////////////////////////////////
-    sf::Clock _lifeTimer;
+    TickTimer _lifeTimer;
 
     ////////////////////////////////////////////////////////////
-    /// \brief sf::Clock to store the time elapsed between updates.
+    /// \brief Timer to store the time elapsed between survival bonuses.
     ////////////////////////////////////////////////////////////
-    sf::Clock _updateTimer;
+    TickTimer _updateTimer;
 
     ////////////////////////////////////////////////////////////
     /// \brief Float to store the longest player life
@@ -14,4 +14,30 @@ void Screen::fadeTextInAndOut(sf::Text &text, sf::Color color, int frequency, sf
     auto i = fabs(sin(change*1/frequency));
     text.setFillColor(sf::Color(color.r,color.g,color.b,i*255));
 
-}
\ No newline at end of file
+}
+
+void Screen::composeLayer(sf::RenderTexture &layer,
+                          const sf::Vector2i resolution,
+                          std::initializer_list<const sf::Drawable *> drawables)
+{
+    if (!layer.create(resolution.x, resolution.y))
+    {
+        throw std::runtime_error("Screen::composeLayer - Unable to create the layer");
+    }
+
+    // Colours are blended as usual, but multiplied by their alpha, while the
+    // alpha builds up, so that the layer holds premultiplied colours
+    sf::BlendMode premultiply(sf::BlendMode::SrcAlpha, sf::BlendMode::OneMinusSrcAlpha, sf::BlendMode::Add,
+                              sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha, sf::BlendMode::Add);
+    layer.clear(sf::Color::Transparent);
+    for (auto drawable : drawables)
+        layer.draw(*drawable, premultiply);
+    layer.display();
+}
+
+void Screen::drawLayer(sf::RenderTarget &window, const sf::RenderTexture &layer)
+{
+    // The layer's colours are already multiplied by their alpha
+    sf::BlendMode premultiplied(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+    window.draw(sf::Sprite(layer.getTexture()), premultiplied);
+}
@@ -13,6 +13,8 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics.hpp"
+#include <initializer_list>
+#include <stdexcept>
 #include "ResourceHolder.hpp"
 #include "Score.hpp"
 
@@ -74,6 +76,32 @@ public:
     {return 0;}
 
 protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draws the parts of a screen that never change into a layer, once,
+    /// so that each frame draws them all as a single sprite (see drawLayer)
+    ///
+    /// The layer is transparent where nothing is drawn. Its colours are kept
+    /// premultiplied by their alpha, so that anti-aliased edges look the same
+    /// as when drawn straight to the window
+    ///
+    /// \param layer The render texture to draw into
+    /// \param resolution The size of the layer (the screen), in pixels
+    /// \param drawables The drawables, in the order they are drawn
+    ///
+    /// \see [SFML/RenderTexture](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1RenderTexture.php)
+    ////////////////////////////////////////////////////////////
+    static void composeLayer(sf::RenderTexture &layer,
+                             const sf::Vector2i resolution,
+                             std::initializer_list<const sf::Drawable *> drawables);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draws a layer made by composeLayer over the whole screen
+    ///
+    /// \param window The window to draw to
+    /// \param layer The layer
+    ////////////////////////////////////////////////////////////
+    static void drawLayer(sf::RenderTarget &window, const sf::RenderTexture &layer);
+
     ////////////////////////////////////////////////////////////
     /// \brief Loops through fading in and out a text object
     ///
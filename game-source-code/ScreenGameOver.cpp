@@ -166,6 +166,16 @@ int ScreenGameOver::draw(sf::RenderWindow &renderWindow,
     accuracy.setPosition(accuracyPositionX,
                              accuracyPositionY);
 
+    ///--------------------------------
+    // Everything but the prompt is fixed once the game is over, so is drawn once
+    sf::RenderTexture staticLayer;
+    composeLayer(staticLayer, resolution,
+                 {&gameOver, &title, &credits,
+                  &scoreTitle, &score,
+                  &maxTimeTitle, &maxTime,
+                  &bulletsFiredTitle, &bulletsFired,
+                  &accuracyTitle, &accuracy});
+
     ///--------------------------------
     // Render
     sf::Event event;
@@ -173,17 +183,7 @@ int ScreenGameOver::draw(sf::RenderWindow &renderWindow,
     while (true)
     {
         renderWindow.clear();
-        renderWindow.draw(gameOver);
-        renderWindow.draw(title);
-        renderWindow.draw(credits);
-        renderWindow.draw(scoreTitle);
-        renderWindow.draw(score);
-        renderWindow.draw(maxTimeTitle);
-        renderWindow.draw(maxTime);
-        renderWindow.draw(bulletsFiredTitle);
-        renderWindow.draw(bulletsFired);
-        renderWindow.draw(accuracyTitle);
-        renderWindow.draw(accuracy);
+        drawLayer(renderWindow, staticLayer);
 
         fadeTextInAndOut(info,sf::Color::White, 50, clock);
 
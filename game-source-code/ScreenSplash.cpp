@@ -111,6 +111,12 @@ int ScreenSplash::draw(sf::RenderWindow &renderWindow,
     auto number_of_stars = 60;
     StarField starField(resolution, 3, number_of_stars);
 
+    // The titles, controls and scores do not change, so are drawn once into a
+    // layer. Only the stars, planet, spaceship and prompt are drawn every frame
+    sf::RenderTexture staticLayer;
+    composeLayer(staticLayer, resolution,
+                 {&title, &version, &controls, &points, &highScoreTitle, &highScore});
+
     // Render
     while (true)
     {
@@ -143,17 +149,12 @@ int ScreenSplash::draw(sf::RenderWindow &renderWindow,
                 frame++;
             }
 
-            for (const auto &element : starField.getStarField())
-                starField.moveAndDrawStars(renderWindow, 0.001, 1);
+            starField.update(timeStep, 3.6f, 1);
+            starField.draw(renderWindow);
             
             renderWindow.draw(planet);
-            renderWindow.draw(title);
+            drawLayer(renderWindow, staticLayer);
             renderWindow.draw(spaceship);
-            renderWindow.draw(version);
-            renderWindow.draw(controls);
-            renderWindow.draw(points);
-            renderWindow.draw(highScoreTitle);
-            renderWindow.draw(highScore);
             renderWindow.draw(info);
 
             renderWindow.display();
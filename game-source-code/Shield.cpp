@@ -10,18 +10,18 @@ Shield::Shield(const Vector2i resolution,
                float distanceFromCentre,
                float angle,
                float scale,
-               const TextureHolder &textureHolder,
-               PlayerShip &playerShip) : _resolution{resolution},
-                                         _distanceFromCentre{distanceFromCentre},
-                                         _angle{angle},
-                                         _scale{scale},
-                                         _playerShip{playerShip}
+               const TextureHolder &textureHolder) : _resolution{resolution},
+                                                    _distanceFromCentre{distanceFromCentre},
+                                                    _angle{angle},
+                                                    _scale{scale}
 {
-    _animationFPSLimit = 0;
+    _stepsPerFrame = 4;
     _rectArea = {0, 0, 256, 256}; // Individual sprite tile
     _spriteOffset = _rectArea.width; // Animated sprite tile-set width
-    _sprite.setTexture(textureHolder.get(textures::Shield));
-    _sprite.setTextureRect(_rectArea);
+    auto region = textureHolder.getRegion(textures::Shield);
+    _atlasOffset = {region.rect.left, region.rect.top};
+    _sprite.setTexture(*region.texture);
+    _sprite.setTextureRect({_atlasOffset.x, _atlasOffset.y, _rectArea.width, _rectArea.height});
     _sprite.setOrigin(_sprite.getGlobalBounds().width / 2, _sprite.getGlobalBounds().height / 2);
     _sprite.setScale(_scale, _scale);
     reset(); //Initialised position invisible, offscreen
@@ -34,11 +34,12 @@ void Shield::reset()
     _rectArea.left = 0;
 }
 
-void Shield::move()
+void Shield::move(const SpriteState &playerShip, float interpolation)
 {
-    _sprite.setPosition(_playerShip.getSprite().getPosition());
-    _sprite.setScale(_playerShip.getSprite().getScale().x * 2.2, _playerShip.getSprite().getScale().y * 2.2);
-    _sprite.setRotation(_playerShip.getSprite().getRotation());
+    auto scale = playerShip.getInterpolatedScale(interpolation);
+    _sprite.setPosition(playerShip.getInterpolatedPosition(interpolation));
+    _sprite.setScale(scale.x * 2.2, scale.y * 2.2);
+    _sprite.setRotation(playerShip.getInterpolatedRotation(interpolation));
 }
 
 const Sprite &Shield::getSprite() const
@@ -46,25 +47,11 @@ const Sprite &Shield::getSprite() const
     return _sprite;
 }
 
-void Shield::update()
+void Shield::update(SimulationClock::Ticks ticksSinceRespawn)
 {
-    if (_playerShip.isInvulnerable())
-    {
-        auto numberFrames = 20;
-        if (_animationFPSLimit >= 3)
-        {
-            _animationFPSLimit = 0;
-            _rectArea.left += _spriteOffset;
-            if (_rectArea.left > (_spriteOffset * (numberFrames - 1))) // Sprite tile-set width - individual tile
-            {
-                _rectArea.left = 0;
-            }
-            _sprite.setTextureRect(_rectArea);
-        } else
-        {
-            _animationFPSLimit++;
-        }
-        move();
-    } else
-        reset();
-}
\ No newline at end of file
+    auto numberFrames = 20;
+    auto frame = static_cast<int>((ticksSinceRespawn / _stepsPerFrame) % numberFrames);
+    _rectArea.left = frame * _spriteOffset;
+    _sprite.setTextureRect({_atlasOffset.x + _rectArea.left, _atlasOffset.y + _rectArea.top,
+                            _rectArea.width, _rectArea.height});
+}
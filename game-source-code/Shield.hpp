@@ -15,7 +15,8 @@
 #include <cmath>
 #include "common.hpp"
 #include "ResourceHolder.hpp"
-#include "PlayerShip.hpp"
+#include "SimulationClock.hpp"
+#include "RenderSnapshot.hpp"
 
 using sf::Vector2f;
 using sf::Vector2i;
@@ -42,25 +43,31 @@ public:
     /// \param scale The scale of the sprite
     /// \param textureHolder The resourceMapper object that
     /// contains the path to the texture(s) for the sprite
-    /// \param playerShip The playerShip that the shield will be positioned on.
     ////////////////////////////////////////////////////////////
     Shield(const sf::Vector2i resolution,
            float distanceFromCentre,
            float angle,
            float scale,
-           const TextureHolder &textureHolder,
-           PlayerShip &playerShip);
+           const TextureHolder &textureHolder);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Performs the move, based on _futureMoveValue.
+    /// \brief Places the shield over the playerShip
+    ///
+    /// \param playerShip The playerShip's state, from the latest RenderSnapshot
+    /// \param interpolation How far between the playerShip's previous (0) and
+    /// current (1) step, to match where the EntityRenderer draws it
     ////////////////////////////////////////////////////////////
-    void move();
+    void move(const SpriteState &playerShip, float interpolation = 1);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Checks and updates the movement, calls
-    /// the actual movement translation with move()
+    /// \brief Shows the animation frame for the time since the playerShip respawned
+    ///
+    /// The frame is worked out from the step count, so the animation runs
+    /// at the speed of the simulation whatever the frame rate
+    ///
+    /// \param ticksSinceRespawn The steps since the playerShip respawned
     ////////////////////////////////////////////////////////////
-    void update();
+    void update(SimulationClock::Ticks ticksSinceRespawn);
 
     ////////////////////////////////////////////////////////////
     /// \brief Resets the Shield object
@@ -103,14 +110,9 @@ private:
     float _scale;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Data member storing a reference to the playerShip object
+    /// \param The number of simulation steps each tile of the tile-set is shown for
     ////////////////////////////////////////////////////////////
-    PlayerShip &_playerShip;
-
-    ////////////////////////////////////////////////////////////
-    /// \param If the tile-set is designed to be less than the game frame-rate, it can be limited here
-    ////////////////////////////////////////////////////////////
-    int _animationFPSLimit;
+    int _stepsPerFrame;
 
     ////////////////////////////////////////////////////////////
     /// \param The animatable texture's active tile area
@@ -121,6 +123,11 @@ private:
     /// \param The pixel offset of the _rectArea, moving the image from frame to frame
     ////////////////////////////////////////////////////////////
     int _spriteOffset;
+
+    ////////////////////////////////////////////////////////////
+    /// \param The top-left of the tile-set in its texture (an atlas page, if it was packed)
+    ////////////////////////////////////////////////////////////
+    Vector2i _atlasOffset;
 };
 
 
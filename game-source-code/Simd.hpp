@@ -0,0 +1,23 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Detection of the SIMD instruction sets the compiler targets
+///
+/// Defines GYRUSS_SSE2 where SSE2 can be used, and includes the intrinsics
+/// whenever any supported instruction set (SSE2, AVX2 or AVX-512) is
+/// targeted. The wider sets are tested with the compiler's own __AVX2__ and
+/// __AVX512F__. Every SIMD path includes this header rather than testing
+/// the targets itself
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_SIMD_HPP
+#define PROJECT_SIMD_HPP
+
+// SSE2 is part of every x86-64 target, and MSVC does not define __SSE2__
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GYRUSS_SSE2
+#endif
+
+#if defined(__AVX2__) || defined(__AVX512F__) || defined(GYRUSS_SSE2)
+#include <immintrin.h>
+#endif
+
+#endif //PROJECT_SIMD_HPP
@@ -0,0 +1,249 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   The game simulation, run on its own thread
+/////////////////////////////////////////////////////////////////////
+
+#include "Simulation.hpp"
+
+Simulation::Simulation(Vector2i resolution,
+                       float shipPathRadius,
+                       float shipScale,
+                       Score &score,
+                       SimulationClock &clock,
+                       float speedModifier,
+                       Random random) : _clock{clock},
+                                        _score{score},
+                                        _playerShip{resolution,
+                                                    shipPathRadius,
+                                                    0,
+                                                    shipScale,
+                                                    entity::PlayerShip},
+                                        _entityController{resolution,
+                                                          _playerShip,
+                                                          score,
+                                                          clock,
+                                                          speedModifier,
+                                                          random.substream(0)},
+                                        _random{random.substream(1)}, // Not the controller's, which it splits further
+                                        _speedTimer{clock},
+                                        _gameState{game::GameState::Playing},
+                                        _winCondition{100}, // Number of enemies needed to kill to win.
+                                        _isStressTest{false},
+                                        _playerShots{0},
+                                        _enemyShots{0},
+                                        _explosions{0},
+                                        _playerDeaths{0},
+                                        _playerFutureAngle{0},
+                                        _commands{0},
+                                        _stopRequested{false}
+{
+    _score.reset();
+}
+
+void Simulation::step()
+{
+    auto increaseSpeedThreshold = 1.5f;     // How often the game speeds up (in seconds)
+    auto globalSpeedIncrease = 0.025f;      // Game speeds up this amount every time that it increases
+    auto moveStep = _input.getMove() * SimulationClock::timeStep;
+
+    _clock.tick();
+    _entityController.storePreviousStates();
+    runCommands();
+
+    // Game gets faster the longer you stay alive
+    if (_speedTimer.getElapsedTime() > increaseSpeedThreshold)
+    {
+        _speedTimer.restart();
+        _entityController.changeGlobalSpeed(globalSpeedIncrease);
+    }
+
+    if (_input.takeShot())
+        _playerShip.setShoot();
+
+    {
+        Profiler::Scope timer(_profiler, Profiler::SpawnEntities);
+        _entityController.spawnEntities();
+    }
+    {
+        Profiler::Scope timer(_profiler, Profiler::SetMove);
+        _entityController.setMove();
+    }
+    {
+        Profiler::Scope timer(_profiler, Profiler::SetPlayerShipMove);
+        _playerShip.setMove(moveStep);
+    }
+    {
+        Profiler::Scope timer(_profiler, Profiler::Shoot);
+        _entityController.shoot();
+    }
+    {
+        Profiler::Scope timer(_profiler, Profiler::CheckClipping);
+        _entityController.checkClipping();
+    }
+
+    // Returns true if the player has collided. (also does global entity collision check)
+    auto playerHasCollided = false;
+    {
+        Profiler::Scope timer(_profiler, Profiler::CheckCollisions);
+        playerHasCollided = _entityController.checkCollisions();
+    }
+    if (playerHasCollided)
+    {
+        if (!_playerShip.isInvulnerable() && !_isStressTest)
+            playerDeathEvents();
+    }
+
+    // Record the sound events before update() clears them
+    _playerFutureAngle = _playerShip.getFutureAngle();
+    if (_playerShip.isShooting())
+        _playerShots++;
+    if (_entityController.explosionOccurred())
+        _explosions++;
+    if (_entityController.shootingOccurred())
+        _enemyShots++;
+
+    {
+        Profiler::Scope timer(_profiler, Profiler::Update);
+        _score.update();
+        _playerShip.update();
+        _entityController.update();
+    }
+
+    endGameCheck();
+}
+
+void Simulation::capture(RenderSnapshot &snapshot)
+{
+    // Drawing order: the playerShip is drawn last, on top
+    snapshot.clear();
+    snapshot.add(_entityController.getEnemies());
+    snapshot.add(_entityController.getBulletsEnemy());
+    snapshot.add(_entityController.getBulletsPlayer());
+    snapshot.add(_entityController.getMeteoroids());
+    snapshot.add(_entityController.getExplosions());
+    snapshot.playerShip = SpriteState{_playerShip};
+
+    snapshot.lives = _playerShip.getLives();
+    snapshot.isInvulnerable = _playerShip.isInvulnerable();
+    snapshot.isUpgraded = _playerShip.isUpgraded();
+    snapshot.playerFutureAngle = _playerFutureAngle;
+    snapshot.ticksSinceRespawn = _playerShip.getTicksSinceRespawn();
+
+    snapshot.score = _score.getScore();
+    snapshot.enemiesKilled = _score.getEnemiesKilled();
+    snapshot.timeAlive = _score.getTimeAlive();
+    snapshot.speed = _entityController.getSpeed();
+
+    snapshot.playerShots = _playerShots;
+    snapshot.enemyShots = _enemyShots;
+    snapshot.explosions = _explosions;
+    snapshot.playerDeaths = _playerDeaths;
+
+    snapshot.gameState = _gameState;
+    snapshot.ticks = _clock.getTicks();
+}
+
+void Simulation::run(TripleBuffer<RenderSnapshot> &snapshots)
+{
+    float timeStep = SimulationClock::timeStep; // 60 steps per second
+    auto maxStepsPerBatch = 5;                  // Catch-up limit after a stall
+    auto timeSinceUpdate = 0.f;                 // Real time not yet simulated (in seconds)
+    auto lastTime = getRealTime();
+
+    while (!_stopRequested.load() && _gameState == game::GameState::Playing)
+    {
+        auto time = getRealTime();
+        timeSinceUpdate += time - lastTime;
+        lastTime = time;
+
+        auto steps = 0;
+        while (timeSinceUpdate >= timeStep
+               && steps < maxStepsPerBatch
+               && _gameState == game::GameState::Playing)
+        {
+            timeSinceUpdate -= timeStep;
+            steps++;
+            step();
+        }
+
+        // Too far behind to catch up (e.g. the window was dragged): drop the
+        // whole steps that were not simulated, rather than running fast for
+        // a while to make them up
+        if (steps == maxStepsPerBatch)
+            timeSinceUpdate = std::fmod(timeSinceUpdate, timeStep);
+
+        if (steps > 0)
+        {
+            auto &snapshot = snapshots.getWriteBuffer();
+            capture(snapshot);
+            snapshot.stepTime = time - timeSinceUpdate;
+            snapshots.publish();
+        }
+
+        if (_gameState == game::GameState::Playing)
+            sf::sleep(sf::seconds(timeStep - timeSinceUpdate));
+    }
+}
+
+void Simulation::runCommands()
+{
+    auto commands = _commands.exchange(0);
+    if (commands == 0)
+        return;
+
+    auto speedChange = 0.1f;
+    if (commands & SpeedUp)
+        _entityController.changeGlobalSpeed(speedChange);
+    if (commands & SlowDown)
+        _entityController.changeGlobalSpeed(-speedChange);
+    if (commands & MakeInvulnerable)
+        _playerShip.makeInvulnerable(true);
+    if (commands & MakeVulnerable)
+        _playerShip.makeInvulnerable(false);
+    if (commands & KillPlayerShip)
+        playerDeathEvents();
+    if (commands & UpgradePlayerShip)
+        _playerShip.upgrade();
+    if (commands & SpawnEnemy)
+    {
+        auto enemyType = static_cast<entity::ID >(_random.nextInt(2));
+        auto textureVariant = static_cast<textures::ID>(_random.nextInt(2));
+        auto movementDir = static_cast<MovementDirection >(_random.nextInt(2));
+        auto movementState = static_cast<MovementState>(_random.nextInt(5));
+        _entityController.spawnBasicEnemy(enemyType,
+                                          textureVariant,
+                                          movementDir,
+                                          movementState);
+    }
+}
+
+void Simulation::playerDeathEvents()
+{
+    _playerShip.die();
+    _score.resetLifeTimer();
+    _entityController.resetGlobalSpeed();
+    _entityController.killAllEnemiesOfType(entity::Satellite);
+    _playerDeaths++;
+}
+
+void Simulation::setStressMode(const StressSettings &settings)
+{
+    _isStressTest = settings.isEnabled();
+    _entityController.setStressMode(settings);
+}
+
+void Simulation::endGameCheck()
+{
+    if (_isStressTest)
+        return;
+
+    if (_playerShip.getLives() <= 0)
+    {
+        _gameState = game::GameOverLose;
+    }
+
+    if (_score.getEnemiesKilled() >= _winCondition)
+    {
+        _score.resetLifeTimer();
+        _gameState = game::GameOverWin;
+    }
+}
@@ -0,0 +1,287 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   The game simulation, run on its own thread
+///
+/// Owns the playerShip and the EntityController, and steps them at the
+/// fixed rate of the SimulationClock. After each batch of steps it
+/// publishes a RenderSnapshot, so that drawing one frame overlaps with
+/// simulating the next instead of adding to it
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_SIMULATION_HPP
+#define PROJECT_SIMULATION_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <atomic>
+#include <SFML/System.hpp>
+#include "common.hpp"
+#include "PlayerShip.hpp"
+#include "EntityController.hpp"
+#include "Score.hpp"
+#include "Random.hpp"
+#include "SimulationClock.hpp"
+#include "PlayerInput.hpp"
+#include "RenderSnapshot.hpp"
+#include "TripleBuffer.hpp"
+#include "Profiler.hpp"
+
+////////////////////////////////////////////////////////////
+/// \brief Simulation Class
+///
+/// One game, from the first step until the playerShip runs out of lives or
+/// enough enemies are killed. run() is the body of the simulation thread;
+/// step() can also be called directly, to run a game without a window or
+/// a second thread.
+///
+/// While run() is running, the other thread may only use getInput(),
+/// request(), stop() and getRealTime(). Everything else it needs comes from
+/// the published snapshots.
+///
+/// \see Game
+/// \see RenderSnapshot
+/// \see PlayerInput
+////////////////////////////////////////////////////////////
+class Simulation
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Developer commands, sent from the render thread (debug keys)
+    ///
+    /// Each is a bit, so several can be pending at once
+    ////////////////////////////////////////////////////////////
+    enum Command : unsigned int
+    {
+        SpeedUp = 1,            /*!< Increase the global speed */
+        SlowDown = 2,           /*!< Decrease the global speed */
+        MakeInvulnerable = 4,   /*!< Shield the playerShip */
+        MakeVulnerable = 8,     /*!< Remove the playerShip's shield */
+        KillPlayerShip = 16,    /*!< Kill the playerShip */
+        UpgradePlayerShip = 32, /*!< Give the playerShip the double shot */
+        SpawnEnemy = 64         /*!< Spawn a random enemy */
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor, setting up a new game
+    ///
+    /// \param resolution The screen resolution of the game
+    /// \param shipPathRadius The radius of the playerShip's circle
+    /// \param shipScale The scale of the playerShip
+    /// \param score The score to keep (reset by the constructor)
+    /// \param clock The clock the game runs on (must outlive the Simulation)
+    /// \param speedModifier How fast the game is at the start
+    /// \param random The random stream the game is generated from
+    ////////////////////////////////////////////////////////////
+    Simulation(Vector2i resolution,
+               float shipPathRadius,
+               float shipScale,
+               Score &score,
+               SimulationClock &clock,
+               float speedModifier,
+               Random random = Random{});
+
+    Simulation(const Simulation&) = delete;
+
+    Simulation &operator=(const Simulation&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Runs one fixed step of the game
+    ////////////////////////////////////////////////////////////
+    void step();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copies the drawable state of the game into a snapshot
+    ///
+    /// \param snapshot The snapshot to fill (its sprites are replaced)
+    ////////////////////////////////////////////////////////////
+    void capture(RenderSnapshot &snapshot);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Steps the game in real time until it is over or stop() is called
+    ///
+    /// Steps are run to catch up with real time (at most five at once, dropping
+    /// the rest after a long stall), a snapshot is published, and the thread
+    /// sleeps until the next step is due.
+    ///
+    /// \param snapshots The buffer to publish a snapshot to after each batch of steps
+    ////////////////////////////////////////////////////////////
+    void run(TripleBuffer<RenderSnapshot> &snapshots);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Makes run() return after the current batch of steps (any thread)
+    ////////////////////////////////////////////////////////////
+    void stop()
+    {_stopRequested.store(true);}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queues a developer command for the next step (any thread)
+    ///
+    /// \param command The command to run
+    ////////////////////////////////////////////////////////////
+    void request(Command command)
+    {_commands.fetch_or(command);}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the player's controls, for the input thread to write
+    ////////////////////////////////////////////////////////////
+    PlayerInput &getInput()
+    {return _input;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Spreads the per-entity loops of each step over a job system.
+    /// Must be called before run()
+    ///
+    /// \param jobs The job system, or nullptr to keep every step on one thread
+    /// \param parallelThreshold The fewest entities in a loop worth spreading across threads
+    ///
+    /// \see EntityController::setJobSystem
+    ////////////////////////////////////////////////////////////
+    void setJobSystem(JobSystem *jobs, std::size_t parallelThreshold = 256)
+    {_entityController.setJobSystem(jobs, parallelThreshold);}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Turns the game into a stress test: the populations are kept
+    /// up, the playerShip cannot die and the game never ends.
+    /// Must be called before the first step
+    ///
+    /// \param settings The populations to keep up
+    ///
+    /// \see EntityController::setStressMode
+    ////////////////////////////////////////////////////////////
+    void setStressMode(const StressSettings &settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the real time since the simulation was created (any thread)
+    ///
+    /// The clock that RenderSnapshot::stepTime is measured on
+    ////////////////////////////////////////////////////////////
+    float getRealTime() const
+    {return _realTime.getElapsedTime().asSeconds();}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns Playing, or the outcome of the game once it is over
+    ////////////////////////////////////////////////////////////
+    game::GameState getGameState() const
+    {return _gameState;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the playerShip
+    ////////////////////////////////////////////////////////////
+    const PlayerShip &getPlayerShip() const
+    {return _playerShip;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the EntityController
+    ////////////////////////////////////////////////////////////
+    const EntityController &getEntityController() const
+    {return _entityController;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the timings of the phases of each step. Only for
+    /// the thread calling step(), or once run() has returned
+    ////////////////////////////////////////////////////////////
+    const Profiler &getProfiler() const
+    {return _profiler;}
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Runs the developer commands requested since the last step
+    ////////////////////////////////////////////////////////////
+    void runCommands();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Kills the playerShip, and clears the screen of satellites
+    ////////////////////////////////////////////////////////////
+    void playerDeathEvents();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Ends the game if the playerShip is out of lives or enough enemies are dead
+    ////////////////////////////////////////////////////////////
+    void endGameCheck();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The clock the game runs on
+    ////////////////////////////////////////////////////////////
+    SimulationClock &_clock;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The score of the game
+    ////////////////////////////////////////////////////////////
+    Score &_score;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The playerShip (declared before the EntityController, which refers to it)
+    ////////////////////////////////////////////////////////////
+    PlayerShip _playerShip;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief All the other entities
+    ////////////////////////////////////////////////////////////
+    EntityController _entityController;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Random stream for the developer commands
+    ////////////////////////////////////////////////////////////
+    Random _random;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Measures the time since the game last sped up
+    ////////////////////////////////////////////////////////////
+    TickTimer _speedTimer;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Playing, or the outcome of the game once it is over
+    ////////////////////////////////////////////////////////////
+    game::GameState _gameState;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of enemies to kill to win
+    ////////////////////////////////////////////////////////////
+    unsigned int _winCondition;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief True in stress mode, where the game does not end
+    ////////////////////////////////////////////////////////////
+    bool _isStressTest;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Running counts of the events that trigger sounds
+    /// \see RenderSnapshot
+    ////////////////////////////////////////////////////////////
+    unsigned int _playerShots;
+    unsigned int _enemyShots;
+    unsigned int _explosions;
+    unsigned int _playerDeaths;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The playerShip's move in the last step, which sets the engine pitch
+    ////////////////////////////////////////////////////////////
+    float _playerFutureAngle;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The player's controls, written by the input thread
+    ////////////////////////////////////////////////////////////
+    PlayerInput _input;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pending developer commands, one bit per Command
+    ////////////////////////////////////////////////////////////
+    std::atomic<unsigned int> _commands;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set by stop(), to end run()
+    ////////////////////////////////////////////////////////////
+    std::atomic<bool> _stopRequested;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Real time, for pacing run() and interpolating snapshots
+    ////////////////////////////////////////////////////////////
+    sf::Clock _realTime;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The timings of the phases of each step
+    ////////////////////////////////////////////////////////////
+    Profiler _profiler;
+};
+
+#endif //PROJECT_SIMULATION_HPP
@@ -0,0 +1,137 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Virtual clock for the game simulation
+///
+/// Game time is counted in fixed steps (ticks), advanced by the game loop,
+/// instead of being read from the operating system. Timers are tick counts,
+/// so reading one is a subtraction, and the game logic does not depend on
+/// how fast the host runs it
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_SIMULATIONCLOCK_HPP
+#define PROJECT_SIMULATIONCLOCK_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstdint>
+
+////////////////////////////////////////////////////////////
+/// \brief SimulationClock Class
+///
+/// Counts the steps the simulation has taken. Each tick() is one fixed step
+/// of timeStep seconds of game time. Whoever drives the clock decides how
+/// many steps to run per real second: none while paused, fewer for slow
+/// motion, and as many as possible for a headless run.
+///
+/// Entities count their own ticks in update() (which runs once per step),
+/// so they do not need a reference to the clock.
+///
+/// \see TickTimer
+/// \see Game
+/// \see EntityController
+/// \see Score
+////////////////////////////////////////////////////////////
+class SimulationClock
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief A number of simulation steps
+    ////////////////////////////////////////////////////////////
+    using Ticks = std::uint64_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The length of one step of game time, in seconds (60 steps per second)
+    ////////////////////////////////////////////////////////////
+    static constexpr float timeStep = 1.f / 60.f;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor, starting the clock at tick 0
+    ////////////////////////////////////////////////////////////
+    SimulationClock() : _ticks{0} {}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Advances the clock by one step
+    ////////////////////////////////////////////////////////////
+    void tick()
+    {_ticks++;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the number of steps taken since the clock started
+    ////////////////////////////////////////////////////////////
+    Ticks getTicks() const
+    {return _ticks;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the game time since the clock started, in seconds
+    ////////////////////////////////////////////////////////////
+    float getTime() const
+    {return toSeconds(_ticks);}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Converts a number of steps to game time
+    ///
+    /// \param ticks The number of steps
+    /// \return The length of the steps, in seconds
+    ////////////////////////////////////////////////////////////
+    static float toSeconds(Ticks ticks)
+    {return ticks * timeStep;}
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of steps taken
+    ////////////////////////////////////////////////////////////
+    Ticks _ticks;
+};
+
+////////////////////////////////////////////////////////////
+/// \brief TickTimer Class
+///
+/// Measures game time on a SimulationClock, with the same interface as
+/// sf::Clock: restart() and an elapsed time. Only the tick it was started
+/// at is stored, so the timer is a small value type. The clock must outlive
+/// the timer.
+///
+/// \see SimulationClock
+////////////////////////////////////////////////////////////
+class TickTimer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor, starting the timer at the clock's current tick
+    ///
+    /// \param clock The clock to measure time on
+    ////////////////////////////////////////////////////////////
+    explicit TickTimer(const SimulationClock &clock) : _clock{&clock},
+                                                       _start{clock.getTicks()} {}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Starts the timer again from the clock's current tick
+    ////////////////////////////////////////////////////////////
+    void restart()
+    {_start = _clock->getTicks();}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the number of steps since the timer was (re)started
+    ////////////////////////////////////////////////////////////
+    SimulationClock::Ticks getElapsedTicks() const
+    {return _clock->getTicks() - _start;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the game time since the timer was (re)started, in seconds
+    ////////////////////////////////////////////////////////////
+    float getElapsedTime() const
+    {return SimulationClock::toSeconds(getElapsedTicks());}
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief The clock the timer reads
+    ////////////////////////////////////////////////////////////
+    const SimulationClock *_clock;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The tick the timer was (re)started at
+    ////////////////////////////////////////////////////////////
+    SimulationClock::Ticks _start;
+};
+
+#endif //PROJECT_SIMULATIONCLOCK_HPP
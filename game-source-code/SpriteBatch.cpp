@@ -0,0 +1,70 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Collects sprites into one vertex array per texture
+/////////////////////////////////////////////////////////////////////
+
+#include "SpriteBatch.hpp"
+#include "FastMath.hpp"
+
+void SpriteBatch::clear()
+{
+    for (auto i = 0u; i < _batchesInUse; i++)
+        _batches[i].vertices.clear();
+    _batchesInUse = 0;
+    _sprites = 0;
+}
+
+void SpriteBatch::add(const sf::Texture &texture,
+                      const sf::IntRect &frame,
+                      sf::Vector2f position,
+                      sf::Vector2f scale,
+                      float rotation,
+                      sf::Color colour)
+{
+    auto &vertices = getBatch(texture).vertices;
+
+    // The corners of the frame about its centre, scaled then rotated (as sf::Sprite does)
+    float sine, cosine;
+    fastmath::sinCosDegrees(rotation, sine, cosine);
+    auto halfWidth = frame.width / 2.f;
+    auto halfHeight = frame.height / 2.f;
+    auto corner = [&](float x, float y)
+    {
+        x *= scale.x;
+        y *= scale.y;
+        return sf::Vector2f{position.x + x * cosine - y * sine,
+                            position.y + x * sine + y * cosine};
+    };
+
+    auto left = static_cast<float>(frame.left);
+    auto top = static_cast<float>(frame.top);
+    auto right = left + frame.width;
+    auto bottom = top + frame.height;
+    vertices.append({corner(-halfWidth, -halfHeight), colour, {left, top}});
+    vertices.append({corner(halfWidth, -halfHeight), colour, {right, top}});
+    vertices.append({corner(halfWidth, halfHeight), colour, {right, bottom}});
+    vertices.append({corner(-halfWidth, halfHeight), colour, {left, bottom}});
+    _sprites++;
+}
+
+void SpriteBatch::draw(sf::RenderTarget &target)
+{
+    for (auto i = 0u; i < _batchesInUse; i++)
+        target.draw(_batches[i].vertices, _batches[i].texture);
+}
+
+SpriteBatch::Batch &SpriteBatch::getBatch(const sf::Texture &texture)
+{
+    // There are only a handful of textures, and runs of sprites share one,
+    // so the most recent batch is tried first
+    for (auto i = _batchesInUse; i > 0; i--)
+    {
+        if (_batches[i - 1].texture == &texture)
+            return _batches[i - 1];
+    }
+
+    if (_batchesInUse == _batches.size())
+        _batches.push_back(Batch{nullptr, sf::VertexArray{sf::Quads}});
+    auto &batch = _batches[_batchesInUse++];
+    batch.texture = &texture;
+    return batch;
+}
@@ -0,0 +1,122 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Collects sprites into one vertex array per texture
+///
+/// Drawing an sf::Sprite is one draw call, with its own render state
+/// set up. With hundreds of entities on screen, most of a frame goes on
+/// that overhead. The batch turns each sprite into a textured quad, and
+/// draws all the quads of one texture with a single call
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_SPRITEBATCH_HPP
+#define PROJECT_SPRITEBATCH_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+////////////////////////////////////////////////////////////
+/// \brief SpriteBatch Class
+///
+/// Between clear() and draw(), add() appends a quad to the batch of the
+/// sprite's texture. The batches are drawn in the order their textures were
+/// first added, so sprites of one texture are drawn over those of textures
+/// added before it (e.g. explosions over enemies), but sprites of different
+/// textures are no longer interleaved.
+///
+/// The vertex arrays keep their memory from frame to frame.
+///
+/// \see EntityRenderer
+////////////////////////////////////////////////////////////
+class SpriteBatch
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Empties every batch, ready for the next frame
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Adds a sprite, as a quad rotated and scaled about the centre of its frame
+    ///
+    /// The result is the same as an sf::Sprite with its origin at the centre
+    /// of the frame
+    ///
+    /// \param texture The texture to draw from. It must outlive the batch
+    /// \param frame The area of the texture to draw
+    /// \param position Where the centre of the frame is drawn
+    /// \param scale The scale of the sprite
+    /// \param rotation The rotation of the sprite, in degrees
+    /// \param colour The colour the texture is multiplied by
+    ////////////////////////////////////////////////////////////
+    void add(const sf::Texture &texture,
+             const sf::IntRect &frame,
+             sf::Vector2f position,
+             sf::Vector2f scale,
+             float rotation,
+             sf::Color colour);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draws each non-empty batch with one draw call
+    ///
+    /// \param target The window (or texture) to draw to
+    ////////////////////////////////////////////////////////////
+    void draw(sf::RenderTarget &target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the number of batches with sprites in them, the draw calls draw() makes
+    ////////////////////////////////////////////////////////////
+    std::size_t getBatchCount() const
+    {return _batchesInUse;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the number of sprites added since clear()
+    ////////////////////////////////////////////////////////////
+    std::size_t getSpriteCount() const
+    {return _sprites;}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the quads of a batch, four vertices per sprite
+    ///
+    /// \param batch The batch, from 0 (the first texture added) to getBatchCount()-1
+    ////////////////////////////////////////////////////////////
+    const sf::VertexArray &getVertices(std::size_t batch) const
+    {return _batches[batch].vertices;}
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief The quads of one texture
+    ////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        const sf::Texture *texture;     /*!< The texture every quad is drawn from */
+        sf::VertexArray vertices;       /*!< The quads, four vertices each */
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the batch of a texture, starting a new one if it has none this frame
+    ///
+    /// \param texture The texture
+    ////////////////////////////////////////////////////////////
+    Batch &getBatch(const sf::Texture &texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The batches of this frame (the first _batchesInUse), followed
+    /// by unused ones kept for their memory
+    ////////////////////////////////////////////////////////////
+    std::vector<Batch> _batches;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of batches started this frame
+    ////////////////////////////////////////////////////////////
+    std::size_t _batchesInUse = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The number of sprites added this frame
+    ////////////////////////////////////////////////////////////
+    std::size_t _sprites = 0;
+};
+
+#endif //PROJECT_SPRITEBATCH_HPP
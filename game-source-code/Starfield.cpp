@@ -7,84 +7,132 @@
 /////////////////////////////////////////////////////////////////////
 
 #include "Starfield.hpp"
+#include "Simd.hpp"
 
 StarField::StarField(
                      const sf::Vector2i resolution,
                      const int max_depth,
                      const int number_of_stars,
-                     float max_size) : _width(resolution.x),
-                                       _height(resolution.y),
-                                       _max_depth(max_depth),
-                                       _number_of_stars(number_of_stars),
-                                       _max_size(max_size)
+                     float max_size,
+                     Random random) : _width(resolution.x),
+                                      _height(resolution.y),
+                                      _max_depth(max_depth),
+                                      _number_of_stars(number_of_stars),
+                                      _max_size(max_size),
+                                      _random(random)
 {
-    srand(127); // A nice prime
-    _star_scale = 0.0f;
-    _star_shape.setPointCount(3);
-    _star_shape.setRadius(max_size);
+    // Each star is a triangle, with three vertices of its own
+    _vertices.setPrimitiveType(sf::Triangles);
+    _vertices.resize(3 * number_of_stars);
 
     //Initialize star random placement
+    _x.reserve(number_of_stars);
+    _y.reserve(number_of_stars);
+    _z.reserve(number_of_stars);
     for( auto i = 0; i < number_of_stars; i++)
     {
-        common::position star_pos;
-        star_pos.x = rand() % _width - (_width / 2.0f);
-        star_pos.y = rand() % _height - (_height / 2.0f);
-        star_pos.z = -1.0f * (rand() % max_depth) - max_depth;
-        _starField.push_back(star_pos);
+        _x.push_back(_random.nextInt(_width) - (_width / 2.0f));
+        _y.push_back(_random.nextInt(_height) - (_height / 2.0f));
+        _z.push_back(-1.0f * _random.nextInt(max_depth) - max_depth);
     }
 }
 
-void StarField::moveAndDrawStars(sf::RenderWindow &renderWindow,
-                                 float speed,
-                                 int light_shift_amount)
+void StarField::update(float seconds,
+                       float speed,
+                       int light_shift_amount)
 {
-    auto i = 0;
-    for (auto &star_pos : _starField)
+    auto distance = speed * seconds;
+    auto maxDepth = static_cast<float>(_max_depth);
+    auto inverseMaxDepth = 1.0f / maxDepth;
+    auto centreX = static_cast<float>(_width / 2);
+    auto centreY = static_cast<float>(_height / 2);
+    auto count = _z.size();
+    auto *x = _x.data();
+    auto *y = _y.data();
+    auto *z = _z.data();
+    auto i = std::size_t{0};
+
+#if defined(GYRUSS_SSE2)
     {
-        // srand(i); // Colors streak instead of flicker
-        // Move
-        star_pos.z += speed;            //Move the stars along z, towards camera
-        i++;                            // For counting which stars to make colorful
+        auto step = _mm_set1_ps(distance);
+        auto furthest = _mm_set1_ps(-maxDepth);
+        auto depth = _mm_set1_ps(maxDepth);
+        auto inverseDepth = _mm_set1_ps(inverseMaxDepth);
+        auto centre = _mm_set1_ps(centreX);
+        auto middle = _mm_set1_ps(centreY);
+        auto zero = _mm_setzero_ps();
+        alignas(16) float projectedX[4], projectedY[4], scale[4];
+        for (; i + 4 <= count; i += 4)
+        {
+            // Move, then send the stars at or behind the camera to the furthest distance
+            auto starZ = _mm_add_ps(_mm_loadu_ps(z + i), step);
+            auto behind = _mm_cmpge_ps(starZ, zero);
+            starZ = _mm_or_ps(_mm_and_ps(behind, furthest), _mm_andnot_ps(behind, starZ));
+            _mm_storeu_ps(z + i, starZ);
 
-        // Rainbow candy
-        auto r = rand() % 128 * 2;      // 0-255,  half range * 2 is brighter color
-        auto g = rand() % 128 * 2;      // These random colors help simulate a
-        auto b = rand() % 128 * 2;      // stylized Red/Blue shift
+            // Stars at the furthest distance are invisible
+            auto visible = _mm_cmpgt_ps(starZ, furthest);
+            auto starScale = _mm_and_ps(visible, _mm_mul_ps(_mm_add_ps(starZ, depth), inverseDepth));
+            _mm_store_ps(scale, starScale);
+            _mm_store_ps(projectedX, _mm_sub_ps(centre, _mm_div_ps(_mm_loadu_ps(x + i), starZ)));
+            _mm_store_ps(projectedY, _mm_add_ps(_mm_div_ps(_mm_loadu_ps(y + i), starZ), middle));
 
-        // Boundaries of stars: between camera plane (0) and max_depth (-z)
-        if (star_pos.z >= 0.0f)         // If star is at or behind camera
-        {
-            star_pos.z = -_max_depth;   // send it to the furthest distance
+            for (auto lane = 0u; lane < 4; lane++)
+                buildStar(i + lane, projectedX[lane], projectedY[lane], scale[lane], light_shift_amount);
         }
-        if (star_pos.z <= -_max_depth)  // star is beyond the furthest distance
-        {
-            _star_scale = 0;            // make it invisible
-        }
-        else                            // Otherwise, move the stars along Z, slower if further away
-        {
-            _star_scale = (star_pos.z + (_max_depth)) / (_max_depth);
-        }
-        if (i % light_shift_amount)     // Dimming and color
+    }
+#endif
+
+    // Scalar fallback, and the last few stars
+    for (; i < count; i++)
+    {
+        // Move
+        z[i] += distance;               //Move the stars along z, towards camera
+
+        // Boundaries of stars: between camera plane (0) and max_depth (-z)
+        if (z[i] >= 0.0f)               // If star is at or behind camera
         {
-            _star_shape.setFillColor(sf::Color(255 * _star_scale, 255 * _star_scale, 255 * _star_scale));
+            z[i] = -maxDepth;           // send it to the furthest distance
         }
-        else
+        auto scale = 0.0f;              // beyond the furthest distance, a star is invisible
+        if (z[i] > -maxDepth)           // Otherwise, move the stars along Z, slower if further away
         {
-            _star_shape.setFillColor(sf::Color(r * _star_scale, g * _star_scale, b * _star_scale));
+            scale = (z[i] + maxDepth) * inverseMaxDepth;
         }
+        buildStar(i, centreX - x[i] / z[i], y[i] / z[i] + centreY, scale, light_shift_amount);
+    }
+}
 
-        // Scaling
-        _star_shape.setRadius(_max_size * _star_scale);
-
-        // Moving
-        _star_shape.setPosition({-star_pos.x / star_pos.z + (_width / 2),
-                                star_pos.y / star_pos.z + (_height / 2)});
-
-        renderWindow.draw(_star_shape);
+void StarField::buildStar(std::size_t star, float x, float y, float scale, int light_shift_amount)
+{
+    // Dimming and color
+    auto brightness = static_cast<sf::Uint8>(255 * scale);
+    auto colour = sf::Color(brightness, brightness, brightness);
+    if (!((star + 1) % light_shift_amount))
+    {
+        // Rainbow candy: a colour channel from each of three runs of bits
+        // of one random number. 0-255, half range * 2 is brighter color.
+        // These random colors help simulate a stylized Red/Blue shift
+        auto bits = _random.next();
+        auto r = static_cast<int>((bits >> 57) & 127) * 2;
+        auto g = static_cast<int>((bits >> 50) & 127) * 2;
+        auto b = static_cast<int>((bits >> 43) & 127) * 2;
+        colour = sf::Color(r * scale, g * scale, b * scale);
     }
+
+    // Scaling, with the corners of a three point sf::CircleShape, which has
+    // its position at the top-left of its bounds
+    const auto cornerX = 0.8660254f; // cos(30)
+    auto radius = _max_size * scale;
+    auto centreX = x + radius;
+    auto centreY = y + radius;
+    auto *vertex = &_vertices[3 * star];
+    vertex[0] = sf::Vertex({centreX, centreY - radius}, colour);
+    vertex[1] = sf::Vertex({centreX + cornerX * radius, centreY + radius / 2}, colour);
+    vertex[2] = sf::Vertex({centreX - cornerX * radius, centreY + radius / 2}, colour);
 }
 
-std::vector<common::position>& StarField::getStarField()
+void StarField::draw(sf::RenderTarget &target) const
 {
-    return _starField;
+    target.draw(_vertices);
 }
@@ -9,17 +9,18 @@
 #define PROJECT_STARFIELD_HPP
 
 #include "SFML/Graphics.hpp"
+#include <cstddef>
 #include <vector>
-#include <iterator>
 #include "common.hpp"
+#include "Random.hpp"
 
-using sf::CircleShape;
 using sf::Vector2i;
 
 ////////////////////////////////////////////////////////////
-/// \brief Creates a starField object, a vector of 3d points
-/// The field is made up of many stars (each star is a
-/// common::position, a struct of three floats
+/// \brief Creates a starField object, a field of 3d points
+/// The field is made up of many stars, stored as separate
+/// x, y and z arrays, so that update() can move and project
+/// several stars at a time with SIMD instructions
 /// The stars are psuedo-randomly generated to fill the volume
 /// enclosed by screen height * screen width * maximum depth
 ////////////////////////////////////////////////////////////
@@ -33,53 +34,72 @@ public:
     /// \param max_depth distance from the "camera plane"
     /// \param number_of_stars The number of stars in the vector
     /// \param max_size The maximum scale of the rectangle of a star
+    /// \param random The random stream for star placement and colour
+    /// (seeded with a constant, so the field is the same every time)
     ////////////////////////////////////////////////////////////
     StarField(const Vector2i resolution,
               const int max_depth,
               const int number_of_stars,
-              float max_size = 6.0f);
+              float max_size = 6.0f,
+              Random random = Random{127});
 
     ////////////////////////////////////////////////////////////
     /// \brief Moves the star positions along -Z in the starField object,
-    /// then draws a square at each position in the starField.
+    /// then builds the triangle of each star in the vertex array
     ///
     /// The movement along Z is not physically accurate,
     /// but uses a fast approximation:
     /// (Δposition - max_depth) / max_depth
     ///
-    /// \param renderWindow The sf:Window object to draw and render to
-    /// \param speed The delta to move the stars
+    /// Called once per frame. The stars are drawn by draw()
+    ///
+    /// With SSE2 (every x86-64 target), four stars are moved, wrapped and
+    /// projected per instruction, otherwise one at a time, with the same result
+    ///
+    /// \param seconds The time since the last update
+    /// \param speed The distance the stars move along Z in a second
     /// \param light_shift_amount Controls amount of colorful stars
     /// light_shift_amount = 0 : undefined behaviour
     /// light_shift_amount = 1 : all stars are colorful
     /// light_shift_amount > 1 : reduces no. of colorful stars
-    ///
-    /// \see [SFML/Window](https://www.sfml-dev.org/documentation/2.4.2/classsf_1_1Window.php)
     ////////////////////////////////////////////////////////////
-    void moveAndDrawStars(
-                          sf::RenderWindow &renderWindow,
-                          float speed = 0.0008,
-                          int light_shift_amount = 3);
+    void update(float seconds,
+                float speed = 2.88f,
+                int light_shift_amount = 3);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Returns a reference to the StarField object
-    /// (for iterating through the elements)
-    /// \return A vector of type position (the star objects)
+    /// \brief Draws every star, as built by the last update(), with one draw call
+    ///
+    /// \param target The window (or texture) to draw to
     ////////////////////////////////////////////////////////////
-    std::vector<common::position> &getStarField();
+    void draw(sf::RenderTarget &target) const;
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Writes the triangle of a star into the vertex array
+    ///
+    /// \param star The index of the star
+    /// \param x The projected x position of the star, on screen
+    /// \param y The projected y position of the star, on screen
+    /// \param scale The star's size and brightness, from 0 (invisible,
+    /// at the furthest depth) to 1 (at the camera)
+    /// \param light_shift_amount Every light_shift_amount'th star is colorful
+    ////////////////////////////////////////////////////////////
+    void buildStar(std::size_t star, float x, float y, float scale, int light_shift_amount);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Vector to store the starField point positions in space.
-    /// This vector has all stars stored in it at any point in time
+    /// \brief The starField point positions in space, one array per axis.
+    /// These have all stars stored in them at any point in time
     ////////////////////////////////////////////////////////////
-    std::vector<common::position> _starField;
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _z;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Defines the shape of the star that flies out of the centre of the screen
+    /// \brief The star that flies out of the centre of the screen is a triangle.
+    /// Three vertices per star, coloured by their star's depth
     ////////////////////////////////////////////////////////////
-    CircleShape _star_shape;
+    sf::VertexArray _vertices;
 
     ////////////////////////////////////////////////////////////
     /// \brief Width of the screen. extracted from the resolution at time of construction
@@ -107,9 +127,9 @@ private:
     const float _max_size;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Used to define the star shape radius and scaling
+    /// \brief The random stream for the star placement and colours
     ////////////////////////////////////////////////////////////
-    float _star_scale;
+    Random _random;
 };
 
 #endif //PROJECT_STARFIELD_HPP
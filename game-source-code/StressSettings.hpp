@@ -0,0 +1,39 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   The entity populations kept up in stress mode
+///
+/// Stress mode fills the game with far more enemies and bullets than
+/// normal play ever spawns, to find where the engine stops scaling
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_STRESSSETTINGS_HPP
+#define PROJECT_STRESSSETTINGS_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+
+////////////////////////////////////////////////////////////
+/// \brief The populations of a stress test. All zero (the default) is normal play
+///
+/// In stress mode the enemies are topped up to their number every step,
+/// using the normal movement states, and the enemies fire extra bullets
+/// until the enemy bullets reach theirs. The playerShip cannot die, and
+/// the game never ends.
+///
+/// \see EntityController::setStressMode
+/// \see Simulation::setStressMode
+////////////////////////////////////////////////////////////
+struct StressSettings
+{
+    std::size_t enemies = 0;        /*!< The number of enemies kept in play */
+    std::size_t bullets = 0;        /*!< The number of enemy bullets kept in play */
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns true if this is a stress test, not normal play
+    ////////////////////////////////////////////////////////////
+    bool isEnabled() const
+    {return enemies > 0 || bullets > 0;}
+};
+
+#endif //PROJECT_STRESSSETTINGS_HPP
@@ -0,0 +1,104 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief   Lock-free hand-over of values from one thread to another
+///
+/// The simulation thread writes a new RenderSnapshot after every batch of
+/// steps, and the render thread draws whichever one is newest. Neither
+/// thread ever waits for the other.
+/////////////////////////////////////////////////////////////////////
+
+#ifndef PROJECT_TRIPLEBUFFER_HPP
+#define PROJECT_TRIPLEBUFFER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <atomic>
+
+////////////////////////////////////////////////////////////
+/// \brief The TripleBuffer class
+///
+/// Three values: one owned by the writer, one owned by the reader, and one
+/// in the middle holding the newest published value. publish() swaps the
+/// writer's value with the middle one, and update() swaps the middle one
+/// with the reader's (if it is newer), each with a single atomic exchange.
+///
+/// The values are reused rather than copied, so a value keeps whatever
+/// memory it allocated (e.g. vector capacity) from two publishes ago.
+/// Values that are never read are overwritten: the reader only sees
+/// the newest one.
+///
+/// Exactly one thread may write, and exactly one thread may read.
+///
+/// \see RenderSnapshot
+/// \see Simulation
+////////////////////////////////////////////////////////////
+template <typename T>
+class TripleBuffer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor, with three default-constructed values
+    ////////////////////////////////////////////////////////////
+    TripleBuffer();
+
+    TripleBuffer(const TripleBuffer&) = delete;
+
+    TripleBuffer &operator=(const TripleBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the value to fill before the next publish() (writer only)
+    ////////////////////////////////////////////////////////////
+    T &getWriteBuffer()
+    {return _buffers[_writeIndex];}
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Makes the write buffer the newest value, and takes the old
+    /// middle value as the next write buffer (writer only)
+    ////////////////////////////////////////////////////////////
+    void publish();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Takes the newest published value as the read buffer, if there
+    /// has been a publish since the last update (reader only)
+    ///
+    /// \return True if the read buffer changed
+    ////////////////////////////////////////////////////////////
+    bool update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the value taken by the last update() (reader only)
+    ////////////////////////////////////////////////////////////
+    const T &getReadBuffer() const
+    {return _buffers[_readIndex];}
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Set in _middle when it holds a value the reader has not taken
+    ////////////////////////////////////////////////////////////
+    static constexpr unsigned int freshFlag = 4;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The three values
+    ////////////////////////////////////////////////////////////
+    T _buffers[3];
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The index of the middle value, plus freshFlag
+    ////////////////////////////////////////////////////////////
+    std::atomic<unsigned int> _middle;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The index of the value owned by the writer
+    ////////////////////////////////////////////////////////////
+    unsigned int _writeIndex;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief The index of the value owned by the reader
+    ////////////////////////////////////////////////////////////
+    unsigned int _readIndex;
+};
+
+// Template classes need to be defined inline
+#include "TripleBuffer.inl"
+
+#endif //PROJECT_TRIPLEBUFFER_HPP
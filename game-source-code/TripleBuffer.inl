@@ -0,0 +1,36 @@
+/////////////////////////////////////////////////////////////////////
+/// \brief  Inline template class implementations for TripleBuffer
+/////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \brief The writer starts with value 0, the middle is value 1 (not fresh),
+/// and the reader starts with value 2
+////////////////////////////////////////////////////////////
+template <typename T>
+TripleBuffer<T>::TripleBuffer() : _middle{1},
+                                  _writeIndex{0},
+                                  _readIndex{2}
+{}
+
+////////////////////////////////////////////////////////////
+/// \brief Release, so that the reader sees everything written to the value
+////////////////////////////////////////////////////////////
+template <typename T>
+void TripleBuffer<T>::publish()
+{
+    auto previous = _middle.exchange(_writeIndex | freshFlag, std::memory_order_acq_rel);
+    _writeIndex = previous & ~freshFlag;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Acquire, to see everything the writer wrote before publishing
+////////////////////////////////////////////////////////////
+template <typename T>
+bool TripleBuffer<T>::update()
+{
+    if ((_middle.load(std::memory_order_relaxed) & freshFlag) == 0)
+        return false;
+    auto previous = _middle.exchange(_readIndex, std::memory_order_acq_rel);
+    _readIndex = previous & ~freshFlag;
+    return true;
+}
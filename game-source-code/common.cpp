@@ -3,15 +3,13 @@
 /////////////////////////////////////////////////////////////////////
 
 #include "common.hpp"
+#include "FastMath.hpp"
 
 namespace common
 {
     float angleFilter(float angle)
     {
-        angle = float(fmod(angle, 360));
-        if (angle < 0)
-            angle += 360;
-        return angle;
+        return fastmath::wrapDegrees(angle);
     }
 
     float degreeToRad(float degree)
@@ -34,3 +32,36 @@ namespace common
         return s;
     }
 }
+
+namespace textures
+{
+    const common::rect getFrame(ID id)
+    {
+        switch (id)
+        {
+            case (EnemyShipGrey) :
+                return {0, 0, 228, 163};
+            case (EnemyShipPurple) :
+                return {0, 0, 212, 160};
+            case (EnemyShipYellow) :
+                return {0, 0, 241, 154};
+            case (PlayerShip) :
+                return {0, 0, 366, 382}; // Individual tile of player_ship_animated.png
+            case (BulletPlayer) :
+            case (BulletEnemy) :
+                return {0, 0, 70, 110};  // Individual tile of the bullet tile-sets
+            case (Meteoroid) :
+                return {0, 0, 119, 124};
+            case (Satellite) :
+                return {0, 0, 281, 192};
+            case (Explosion) :
+                return {0, 0, 128, 128}; // Individual tile of explosion.png
+            case (Shield) :
+                return {0, 0, 256, 256}; // Individual tile of shield.png
+            case (Planet) :
+                return {0, 0, 256, 256}; // Individual tile of earth.png
+            default :
+                return {0, 0, 0, 0};
+        }
+    }
+}
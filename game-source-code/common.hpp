@@ -6,9 +6,7 @@
 #define PROJECT_COMMON_HPP
 
 #include <cmath>
-#include <SFML/Graphics.hpp>
-#include <SFML/Audio/Sound.hpp>
-#include "ResourceHolder.hpp"
+#include <string>
 
 using std::string;
 using std::to_string;
@@ -28,10 +26,39 @@ namespace common
         float z; /*!< z co-ordinate */
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Simple struct of 4 ints, a rectangular area of a texture in pixels
+    ///
+    /// Mirrors sf::IntRect, so that the simulation can describe texture frames
+    /// without depending on SFML Graphics
+    ////////////////////////////////////////////////////////////
+    struct rect
+    {
+        int left;   /*!< left edge (x) */
+        int top;    /*!< top edge (y) */
+        int width;  /*!< width of the area */
+        int height; /*!< height of the area */
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Simple struct of 4 bytes, an RGBA colour
+    ///
+    /// Mirrors sf::Color, so that the simulation can describe entity tinting
+    /// without depending on SFML Graphics
+    ////////////////////////////////////////////////////////////
+    struct colour
+    {
+        unsigned char r; /*!< red component */
+        unsigned char g; /*!< green component */
+        unsigned char b; /*!< blue component */
+        unsigned char a; /*!< alpha component */
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Ensures that the angle is always between 0 and 360
     /// \param angle The angle to check
     /// \return The float angle from 0 to 360
+    /// \see fastmath::wrapDegrees
     ////////////////////////////////////////////////////////////
     float angleFilter(float angle);
 
@@ -115,6 +142,18 @@ namespace textures
         testTexture,        /*!< USED FOR TESTING ONLY */
         textureID_end       /*!< Final entry, used to allow iteration on an enum */
     };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the area of a single frame (tile) of a texture, in pixels
+    ///
+    /// The simulation needs the dimensions of an entity to work out its bounds
+    /// for collisions, without loading the image. The values must match the files
+    /// in the resources folder (for animated tile-sets, the size of one tile)
+    ///
+    /// \param id The texture ID
+    /// \return A rect at {0,0}, with the width and height of one frame
+    ////////////////////////////////////////////////////////////
+    const common::rect getFrame(ID id);
 }
 ////////////////////////////////////////////////////////////
 /// \brief A namespace to collect the ID keys for the game sound-fx file resources
@@ -173,14 +212,4 @@ namespace game
     };
 }
 
-////////////////////////////////////////////////////////////
-// Forward declaration
-////////////////////////////////////////////////////////////
-template<typename Resource, typename Identifier>
-class ResourceHolder;
-
-typedef ResourceHolder<sf::Texture, textures::ID> TextureHolder;
-typedef ResourceHolder<sf::SoundBuffer, sounds::ID> SoundHolder;
-typedef ResourceHolder<sf::Font, fonts::ID> FontHolder;
-
 #endif //PROJECT_COMMON_HPP
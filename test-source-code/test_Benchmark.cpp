@@ -0,0 +1,301 @@
+//--------------------------------------------------------------------------
+// @brief   Microbenchmarks of the game's hot kernels
+//
+// game_bench [filter]
+//
+// Times each kernel over several entity counts, and writes one CSV line per
+// benchmark and count, in nanoseconds per operation (per entity, or per call
+// for the kernels that do not loop over entities). Only benchmarks whose
+// name contains the filter are run. Run from the executables directory, so
+// that the resources are found, and from an optimised build.
+//--------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "../game-source-code/common.hpp"
+#include "../game-source-code/Bullet.hpp"
+#include "../game-source-code/Enemy.hpp"
+#include "../game-source-code/EntityController.hpp"
+#include "../game-source-code/HUD.hpp"
+#include "../game-source-code/JobSystem.hpp"
+#include "../game-source-code/PerlinNoise.hpp"
+#include "../game-source-code/PlayerShip.hpp"
+#include "../game-source-code/Random.hpp"
+#include "../game-source-code/RenderSnapshot.hpp"
+#include "../game-source-code/ResourceHolder.hpp"
+#include "../game-source-code/Score.hpp"
+#include "../game-source-code/SimulationClock.hpp"
+#include "../game-source-code/Starfield.hpp"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Results are written here, so the compiler cannot drop the work that produces them
+    volatile float sink;
+
+    const auto resolution = sf::Vector2i{1920, 1080};
+    const std::vector<std::size_t> entityCounts = {16, 256, 4096};
+
+    // Every batch is timed for at least this long, and the fastest of several
+    // repeats is reported, which is the most repeatable figure on a busy machine
+    const auto minimumBatchTime = std::chrono::milliseconds(50);
+    const auto repeats = 5;
+
+    std::string filter;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Times a batch of count operations, and writes the ns per operation
+    ///
+    /// \param name The name of the benchmark
+    /// \param count The number of operations in one batch
+    /// \param batch Runs the batch once
+    ////////////////////////////////////////////////////////////
+    void benchmark(const std::string &name, std::size_t count, const std::function<void()> &batch)
+    {
+        if (name.find(filter) == std::string::npos)
+            return;
+
+        batch(); // Warm the caches
+        auto fastest = std::numeric_limits<double>::max();
+        for (auto repeat = 0; repeat < repeats; repeat++)
+        {
+            auto batches = 0ull;
+            auto start = Clock::now();
+            auto elapsed = Clock::duration{0};
+            do
+            {
+                batch();
+                batches++;
+                elapsed = Clock::now() - start;
+            } while (elapsed < minimumBatchTime);
+
+            std::chrono::duration<double, std::nano> nanoseconds = elapsed;
+            fastest = std::min(fastest, nanoseconds.count() / (batches * count));
+        }
+        std::cout << name << ',' << count << ',' << fastest << std::endl;
+    }
+
+    // Enemies spread around the screen, each with its own random stream
+    std::vector<Enemy> makeEnemies(std::size_t count)
+    {
+        std::vector<Enemy> enemies;
+        Random random{2017};
+        for (auto i = 0u; i < count; i++)
+            enemies.emplace_back(resolution,
+                                 random.nextFloat(0.f, resolution.y / 2.f),
+                                 random.nextFloat(0.f, 360.f),
+                                 0.5f,
+                                 entity::Basic,
+                                 textures::EnemyShipGrey,
+                                 MovementState::SpiralOut,
+                                 MovementDirection::Clockwise,
+                                 random.substream(i));
+        return enemies;
+    }
+
+    std::vector<Bullet> makeBullets(std::size_t count)
+    {
+        std::vector<Bullet> bullets;
+        Random random{1964};
+        for (auto i = 0u; i < count; i++)
+            bullets.emplace_back(resolution,
+                                 random.nextFloat(0.f, resolution.y / 2.f),
+                                 random.nextFloat(0.f, 360.f),
+                                 0.5f,
+                                 entity::PlayerBullet,
+                                 textures::BulletPlayer);
+        return bullets;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+        filter = argv[1];
+
+    std::cout << "benchmark,count,ns_per_op" << std::endl;
+
+    // The kernels that draw need a window (and so a graphics context). It is not shown
+    sf::RenderWindow window(sf::VideoMode(resolution.x, resolution.y), "game_bench");
+    window.setVisible(false);
+
+    TextureHolder textures;
+    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
+    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
+    textures.load(textures::BulletEnemy, "resources/bullet_enemy.png");
+    textures.load(textures::Meteoroid, "resources/meteoroid.png");
+    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
+    textures.load(textures::EnemyShipPurple, "resources/enemyship_purple.png");
+    textures.load(textures::EnemyShipYellow, "resources/enemyship_yellow.png");
+    textures.load(textures::Satellite, "resources/satellite.png");
+    textures.load(textures::Explosion, "resources/explosion.png");
+    textures.load(textures::Shield, "resources/shield.png");
+    const std::vector<textures::ID> loadedTextures = {textures::PlayerShip, textures::BulletPlayer,
+                                                      textures::BulletEnemy, textures::Meteoroid,
+                                                      textures::EnemyShipGrey, textures::EnemyShipPurple,
+                                                      textures::EnemyShipYellow, textures::Satellite,
+                                                      textures::Explosion, textures::Shield};
+    FontHolder fonts;
+    fonts.load(fonts::Title, "resources/danube.ttf");
+    fonts.load(fonts::Default, "resources/fax_sans_beta.otf");
+
+    JobSystem jobs;
+
+    for (auto count : entityCounts)
+    {
+        // EntityController::collides, between pairs of enemies and bullets
+        {
+            PlayerShip playerShip(resolution, resolution.y / 2.f, 0, 0.22f, entity::PlayerShip);
+            SimulationClock clock;
+            Score score(clock);
+            EntityController entityController(resolution, playerShip, score, clock, 1);
+            auto enemies = makeEnemies(count);
+            auto bullets = makeBullets(count);
+            benchmark("EntityController::collides", count, [&] {
+                auto collisions = 0;
+                for (auto i = 0u; i < count; i++)
+                    collisions += entityController.collides(enemies[i], bullets[i]);
+                sink = collisions;
+            });
+        }
+
+        // PerlinNoise::noise, along the time axis as the wandering enemies use it
+        {
+            PerlinNoise noise(1664525);
+            benchmark("PerlinNoise::noise", count, [&] {
+                auto total = 0.0;
+                for (auto i = 0u; i < count; i++)
+                    total += noise.noise(i * 0.37);
+                sink = static_cast<float>(total);
+            });
+        }
+
+        // Enemy::move and Enemy::setOrientation, circling the centre
+        {
+            auto enemies = makeEnemies(count);
+            benchmark("Enemy::move+setOrientation", count, [&] {
+                for (auto &enemy : enemies)
+                {
+                    enemy.setMove(2.f, 0.f);
+                    enemy.move();
+                    enemy.setOrientation();
+                }
+                sink = enemies.front().getAngle();
+            });
+        }
+
+        // The same loop spread over every core, as EntityController::forEachIndex
+        // does past its parallel threshold. Where this overtakes the loop above
+        // is the threshold to use on that machine
+        {
+            auto enemies = makeEnemies(count);
+            benchmark("Enemy::move+setOrientation (parallelFor)", count, [&] {
+                jobs.parallelFor(count, 1, [&enemies](std::size_t begin, std::size_t end) {
+                    for (auto i = begin; i < end; i++)
+                    {
+                        enemies[i].setMove(2.f, 0.f);
+                        enemies[i].move();
+                        enemies[i].setOrientation();
+                    }
+                });
+                sink = enemies.front().getAngle();
+            });
+        }
+
+        // Bullet::move, back and forth so that the bullets stay on screen
+        {
+            auto bullets = makeBullets(count);
+            auto direction = 1.f;
+            benchmark("Bullet::move", count, [&] {
+                direction = -direction;
+                for (auto &bullet : bullets)
+                {
+                    bullet.setMove(direction);
+                    bullet.move();
+                }
+                sink = bullets.front().getRadius();
+            });
+        }
+
+        // StarField::update and StarField::draw, per star
+        {
+            StarField starField(resolution, 3, static_cast<int>(count));
+            benchmark("StarField::update", count, [&] {
+                starField.update(1.f / 60.f);
+            });
+            benchmark("StarField::draw", count, [&] {
+                starField.draw(window);
+                window.clear();
+            });
+        }
+
+        // A frame of the star field, per star: once, and as it was drawn before the
+        // update was split from the draw, once for every star in the field. The
+        // nested loop is quadratic, so it is only timed for the smaller fields
+        {
+            StarField starField(resolution, 3, static_cast<int>(count));
+            benchmark("StarField frame", count, [&] {
+                starField.update(1.f / 60.f);
+                starField.draw(window);
+                window.clear();
+            });
+            if (count <= 256)
+            {
+                benchmark("StarField frame (nested loop)", count, [&] {
+                    for (auto i = 0u; i < count; i++)
+                    {
+                        starField.update(1.f / 60.f / count);
+                        starField.draw(window);
+                    }
+                    window.clear();
+                });
+            }
+        }
+
+        // common::angleFilter, over angles either side of 0 to 360
+        {
+            std::vector<float> angles(count);
+            Random random{42};
+            for (auto &angle : angles)
+                angle = random.nextFloat(-720.f, 720.f);
+            benchmark("common::angleFilter", count, [&] {
+                auto total = 0.f;
+                for (auto angle : angles)
+                    total += common::angleFilter(angle);
+                sink = total;
+            });
+        }
+
+        // HUD::draw, per call (count calls per batch)
+        {
+            HUD hud(resolution, window, fonts);
+            RenderSnapshot snapshot;
+            snapshot.lives = 3;
+            snapshot.score = 12345;
+            benchmark("HUD::draw", count, [&] {
+                for (auto i = 0u; i < count; i++)
+                    hud.draw(snapshot);
+                window.clear();
+            });
+        }
+
+        // ResourceHolder::get, per lookup, cycling through the loaded textures
+        {
+            benchmark("ResourceHolder::get", count, [&] {
+                auto total = 0u;
+                for (auto i = 0u; i < count; i++)
+                    total += textures.get(loadedTextures[i % loadedTextures.size()]).getSize().x;
+                sink = static_cast<float>(total);
+            });
+        }
+    }
+
+    return 0;
+}
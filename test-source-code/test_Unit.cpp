@@ -9,7 +9,10 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 
 #include <chrono>
+#include <set>
+#include <sstream>
 #include <thread>
+#include <type_traits>
 #include "math.h"
 #include "../game-source-code/common.hpp"
 #include "../game-source-code/Bullet.hpp"
@@ -18,6 +21,18 @@
 #include "../game-source-code/EntityController.hpp"
 #include "../game-source-code/Explosion.hpp"
 #include "../game-source-code/Game.hpp"
+#include "../game-source-code/Random.hpp"
+#include "../game-source-code/EntityPool.hpp"
+#include "../game-source-code/PolarGrid.hpp"
+#include "../game-source-code/CollisionKernel.hpp"
+#include "../game-source-code/FastMath.hpp"
+#include "../game-source-code/SimulationClock.hpp"
+#include "../game-source-code/Simulation.hpp"
+#include "../game-source-code/TripleBuffer.hpp"
+#include "../game-source-code/PlayerInput.hpp"
+#include "../game-source-code/JobSystem.hpp"
+#include "../game-source-code/BatchRunner.hpp"
+#include "../game-source-code/Profiler.hpp"
 
 
 #include "doctest.h"
@@ -47,6 +62,42 @@ TEST_CASE ("Getting a texture previously loaded into a resourceHandler<sf::Textu
             CHECK_NOTHROW(elf.setTexture(texture_holder.get(textures::testTexture)));
 }
 
+TEST_CASE ("Packed textures share an atlas page, in separate regions holding the same pixels")
+{
+    TextureHolder texture_holder;
+    texture_holder.load(textures::BulletPlayer, "resources/bullet_player.png");
+    texture_holder.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
+    texture_holder.packAtlas({textures::BulletPlayer, textures::EnemyShipGrey});
+            REQUIRE(texture_holder.getAtlasPageCount() == 1);
+
+    auto bullet = texture_holder.getRegion(textures::BulletPlayer);
+    auto enemy = texture_holder.getRegion(textures::EnemyShipGrey);
+            CHECK(bullet.texture == enemy.texture);
+            CHECK(bullet.texture != &texture_holder.get(textures::BulletPlayer));
+            CHECK(bullet.rect.width == 420);
+            CHECK(bullet.rect.height == 110);
+            CHECK_FALSE(bullet.rect.intersects(enemy.rect));
+
+    auto original = texture_holder.get(textures::EnemyShipGrey).copyToImage();
+    auto page = enemy.texture->copyToImage();
+    auto x = enemy.rect.width / 2, y = enemy.rect.height / 2;
+            CHECK(page.getPixel(enemy.rect.left + x, enemy.rect.top + y) == original.getPixel(x, y));
+}
+
+TEST_CASE ("A texture too large for an atlas page is drawn from its own texture")
+{
+    TextureHolder texture_holder;
+    texture_holder.load(textures::BulletPlayer, "resources/bullet_player.png");
+    texture_holder.load(textures::Meteoroid, "resources/meteoroid.png");
+    texture_holder.packAtlas({textures::BulletPlayer, textures::Meteoroid}, 256);
+            CHECK(texture_holder.getAtlasPageCount() == 1);
+
+    auto bullet = texture_holder.getRegion(textures::BulletPlayer);
+            CHECK(bullet.texture == &texture_holder.get(textures::BulletPlayer));
+            CHECK(bullet.rect == sf::IntRect(0, 0, 420, 110));
+            CHECK(texture_holder.getRegion(textures::Meteoroid).texture != &texture_holder.get(textures::Meteoroid));
+}
+
 //Check SoundHolder
 TEST_CASE ("Loading a missing file into a resourceHandler<sf::SoundBuffer, sounds::ID> throws an exception")
 {
@@ -110,10 +161,6 @@ TEST_CASE (
 
 TEST_CASE ("Creating A PlayerShip object succeeds")
 {
-    TextureHolder textures;
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -124,8 +171,7 @@ TEST_CASE ("Creating A PlayerShip object succeeds")
                                   shipPathRadius,
                                   0,
                                   shipScale,
-                                  entity::PlayerShip,
-                                  textures);
+                                  entity::PlayerShip);
     );
 
 }
@@ -133,10 +179,6 @@ TEST_CASE ("Creating A PlayerShip object succeeds")
 // Check rotation works with .setEnemyMoveState & .setPlayerShipMove
 TEST_CASE ("Moving a PlayerShip 10 degrees succeeds")
 {
-    TextureHolder textures;
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -145,8 +187,7 @@ TEST_CASE ("Moving a PlayerShip 10 degrees succeeds")
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); //move playerShip to origin
     auto originalAngle = playerShip.getAngle();
     auto moveAngle = 10.0f;
@@ -160,7 +201,6 @@ TEST_CASE ("PlayerShip getPosition and underlying transformation both return the
 {
     TextureHolder textures;
     textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
 
     auto resolution = sf::Vector2i{1920, 1080};
     auto shipPathRadiusPadding = 0.05f;
@@ -170,14 +210,14 @@ TEST_CASE ("PlayerShip getPosition and underlying transformation both return the
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); //move playerShip to origin
     auto originalAngle = playerShip.getAngle();
     auto moveAngle = 10.0f;
     playerShip.setMove(moveAngle);
     playerShip.update();
-    auto spriteLocation = playerShip.getSprite().getPosition();
+    EntityRenderer entityRenderer(textures);
+    auto spriteLocation = entityRenderer.getSprite(playerShip).getPosition();
     auto getPositionLocation = playerShip.getPosition();
             CHECK(spriteLocation == getPositionLocation);
 }
@@ -185,10 +225,6 @@ TEST_CASE ("PlayerShip getPosition and underlying transformation both return the
 // Tests holding down move button
 TEST_CASE ("Moving a PlayerShip multiple times succeeds")
 {
-    TextureHolder textures;
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -197,8 +233,7 @@ TEST_CASE ("Moving a PlayerShip multiple times succeeds")
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); //move playerShip to origin
     auto originalAngle = playerShip.getAngle();
     auto moveAngle = 10.0f; //define to move the ship 10 degrees
@@ -214,10 +249,6 @@ TEST_CASE ("Moving a PlayerShip multiple times succeeds")
 // Correct circle implementedd
 TEST_CASE ("Moving a PlayerShip 360 degrees brings ship back to where it started")
 {
-    TextureHolder textures;
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -226,8 +257,7 @@ TEST_CASE ("Moving a PlayerShip 360 degrees brings ship back to where it started
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); //move playerShip to origin
     auto originalAngle = playerShip.getAngle();
     auto originalPosition = playerShip.getPosition();
@@ -247,10 +277,6 @@ TEST_CASE ("Moving a PlayerShip 360 degrees brings ship back to where it started
 // Check "angleFilter" function
 TEST_CASE ("Moving a PlayerShip -10 degrees correctly casts to 350 and succeeds")
 {
-    TextureHolder textures;
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -259,8 +285,7 @@ TEST_CASE ("Moving a PlayerShip -10 degrees correctly casts to 350 and succeeds"
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); // Move playerShip to origin
     auto originalAngle = playerShip.getAngle();
     auto moveAngle = -10.0f;
@@ -273,10 +298,6 @@ TEST_CASE ("Moving a PlayerShip -10 degrees correctly casts to 350 and succeeds"
 
 TEST_CASE ("Moving a PlayerShip moves the sprite the correct number of pixels (flip 180)")
 {
-    TextureHolder textures;
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -285,8 +306,7 @@ TEST_CASE ("Moving a PlayerShip moves the sprite the correct number of pixels (f
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); // Move playerShip to origin
     auto originalLocation = playerShip.getPosition();
     auto moveAngle = 180;
@@ -300,10 +320,6 @@ TEST_CASE ("Moving a PlayerShip moves the sprite the correct number of pixels (f
 
 TEST_CASE ("Reseting ship position brings the ship back to spawning point sucessfully")
 {
-    TextureHolder textures;
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -312,8 +328,7 @@ TEST_CASE ("Reseting ship position brings the ship back to spawning point sucess
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); // Move playerShip to origin
     auto originalLocation = playerShip.getPosition();
     auto moveAngle = 180;
@@ -328,10 +343,6 @@ TEST_CASE ("Reseting ship position brings the ship back to spawning point sucess
 
 TEST_CASE ("Killing the playerShip decrements a life")
 {
-    TextureHolder textures;
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -340,8 +351,7 @@ TEST_CASE ("Killing the playerShip decrements a life")
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); // Move playerShip to origin
     auto startingLives = playerShip.getLives();
     auto startingPosition = playerShip.getPosition();
@@ -358,10 +368,6 @@ TEST_CASE ("Killing the playerShip decrements a life")
 
 TEST_CASE ("Killing the playerShip resets the ship location to centre")
 {
-    TextureHolder textures;
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -370,8 +376,7 @@ TEST_CASE ("Killing the playerShip resets the ship location to centre")
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); // Move playerShip to origin
     auto startingLives = playerShip.getLives();
     auto startingPosition = playerShip.getPosition();
@@ -393,10 +398,6 @@ TEST_CASE ("Killing the playerShip resets the ship location to centre")
 
 TEST_CASE ("Killing the playerShip makes the ship Invulnerable")
 {
-    TextureHolder textures;
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -405,8 +406,7 @@ TEST_CASE ("Killing the playerShip makes the ship Invulnerable")
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); //Move playerShip to origin
     auto startingLives = playerShip.getLives();
     auto startingPosition = playerShip.getPosition();
@@ -428,9 +428,6 @@ TEST_CASE ("Killing the playerShip makes the ship Invulnerable")
 // Bullet movement tests
 TEST_CASE ("Creating a bullet entity succeeds")
 {
-    TextureHolder textures;
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto bulletShootAngle = 180;
     auto bulletStartingPoint = resolution.y; // Define the starting distance from centre
@@ -440,16 +437,12 @@ TEST_CASE ("Creating a bullet entity succeeds")
                           bulletShootAngle,
                           0.5,
                           entity::PlayerBullet,
-                          textures,
                           textures::BulletPlayer);
     );
 }
 
 TEST_CASE ("Shooting a bullet stright up moves corretly")
 {
-    TextureHolder textures;
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto bulletShootAngle = 180; // Bullet moves directly up
     auto bulletStartingPoint = resolution.y; // Define the starting distance from centre;
@@ -458,7 +451,6 @@ TEST_CASE ("Shooting a bullet stright up moves corretly")
                   bulletShootAngle,
                   0.5,
                   entity::PlayerBullet,
-                  textures,
                   textures::BulletPlayer);
     auto startingPosition = bullet.getPosition();
     auto desiredBulletMove = -1; // Move the bullet 2 pixels away from starting point, from point of fire
@@ -473,9 +465,6 @@ TEST_CASE ("Shooting a bullet stright up moves corretly")
 
 TEST_CASE ("Shooting a bullet stright up causes them to scale down as they fly away")
 {
-    TextureHolder textures;
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto bulletShootAngle = 180;
     auto bulletStartingPoint = resolution.y; // Define the starting distance from centre;
@@ -484,7 +473,6 @@ TEST_CASE ("Shooting a bullet stright up causes them to scale down as they fly a
                   bulletShootAngle,
                   0.5,
                   entity::PlayerBullet,
-                  textures,
                   textures::BulletPlayer);
     auto startingScale = bullet.getRadius();
     auto desiredBulletMove = -10;
@@ -497,9 +485,6 @@ TEST_CASE ("Shooting a bullet stright up causes them to scale down as they fly a
 
 TEST_CASE ("Shooting a bullet fired from the centre scales up as it moves outwards")
 {
-    TextureHolder textures;
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto bulletShootAngle = 180;
     auto bulletStartingPoint = resolution.y / 2; //define the starting distance from centre;
@@ -508,7 +493,6 @@ TEST_CASE ("Shooting a bullet fired from the centre scales up as it moves outwar
                   bulletShootAngle,
                   0.5,
                   entity::PlayerBullet,
-                  textures,
                   textures::BulletPlayer);
     auto startingScale = bullet.getRadius();
     auto desiredBulletMove = 10;
@@ -519,6 +503,75 @@ TEST_CASE ("Shooting a bullet fired from the centre scales up as it moves outwar
             CHECK(finalScale > startingScale);
 }
 
+TEST_CASE ("A bullet's stored distance and angle match its position on screen")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    Bullet bullet(resolution,
+                  300,
+                  30,
+                  0.5,
+                  entity::PlayerBullet,
+                  textures::BulletPlayer);
+    bullet.setMove(-10);
+    bullet.update();
+    auto offset = bullet.getPosition() - sf::Vector2f(resolution.x / 2, resolution.y / 2);
+    CHECK(bullet.getRadius() == doctest::Approx(std::sqrt(offset.x * offset.x + offset.y * offset.y)).epsilon(0.001));
+    CHECK(bullet.getAngle() == doctest::Approx(common::radToDegree(std::atan2(offset.x, offset.y))).epsilon(0.001));
+}
+
+TEST_CASE ("A bullet's normalised distance from the centre is the same at any resolution")
+{
+    auto large = sf::Vector2i{1920, 1080};
+    auto small = sf::Vector2i{1280, 720};
+    Bullet bulletLarge(large, large.y / 4, 90, 0.5, entity::EnemyBullet, textures::BulletEnemy);
+    Bullet bulletSmall(small, small.y / 4, 90, 0.5, entity::EnemyBullet, textures::BulletEnemy);
+    CHECK(bulletLarge.getNormalisedRadius() == doctest::Approx(0.5));
+    CHECK(bulletSmall.getNormalisedRadius() == doctest::Approx(bulletLarge.getNormalisedRadius()));
+}
+
+TEST_CASE ("A bullet is drawn between its previous and current step")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    Bullet bullet(resolution,
+                  300,
+                  30,
+                  0.5,
+                  entity::PlayerBullet,
+                  textures::BulletPlayer);
+    bullet.storePreviousState();
+    auto previous = bullet.getPosition();
+    bullet.setMove(-10);
+    bullet.update();
+    auto current = bullet.getPosition();
+    auto halfway = bullet.getInterpolatedPosition(0.5);
+    CHECK(bullet.getInterpolatedPosition(0).x == doctest::Approx(previous.x));
+    CHECK(bullet.getInterpolatedPosition(1).y == doctest::Approx(current.y));
+    CHECK(halfway.x == doctest::Approx((previous.x + current.x) / 2));
+    CHECK(halfway.y == doctest::Approx((previous.y + current.y) / 2));
+    // A reset is not interpolated: the bullet is drawn where it was reset to
+    bullet.reset();
+    CHECK(bullet.getInterpolatedPosition(0).x == doctest::Approx(bullet.getPosition().x));
+}
+
+TEST_CASE ("The playerShip's interpolated rotation turns the short way past 0 degrees")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    auto shipPathRadius = (resolution.y / 2) - (resolution.y * 0.05f);
+    PlayerShip playerShip(resolution,
+                          shipPathRadius,
+                          0,
+                          1,
+                          entity::PlayerShip);
+    playerShip.setMove(2);
+    playerShip.update();
+    playerShip.storePreviousState();
+    playerShip.setMove(-4);
+    playerShip.update();
+    // Rotation goes from -2 to +2 degrees, so halfway is 0 (not 180)
+    auto halfway = fastmath::wrapDegrees(playerShip.getInterpolatedRotation(0.5));
+    CHECK(std::fmin(halfway, 360 - halfway) < 0.01);
+}
+
 ////////////////////////////////////////////////////////////
 ///  Movement tests for Meteoroid
 ////////////////////////////////////////////////////////////
@@ -526,9 +579,6 @@ TEST_CASE ("Shooting a bullet fired from the centre scales up as it moves outwar
 // Meteoroid unit tests
 TEST_CASE ("Creating a meteoroid entity succeeds")
 {
-    TextureHolder textures;
-    textures.load(textures::Meteoroid, "resources/meteoroid.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto meteoroidShootAngle = 180;
     auto meteoroidStartingPoint = resolution.y; // Define the starting distance from centre;
@@ -538,16 +588,12 @@ TEST_CASE ("Creating a meteoroid entity succeeds")
                           meteoroidShootAngle,
                           0.5,
                           entity::Meteoroid,
-                          textures,
                           textures::Meteoroid);
     );
 }
 
 TEST_CASE ("Shooting a meteoroid stright up moves corretly")
 {
-    TextureHolder textures;
-    textures.load(textures::Meteoroid, "resources/meteoroid.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto meteoroidShootAngle = 180; // Meteoroid moves directly up
     auto meteoroidStartingPoint = resolution.y; //Define the starting distance from centre;
@@ -556,7 +602,6 @@ TEST_CASE ("Shooting a meteoroid stright up moves corretly")
                   meteoroidShootAngle,
                   0.5,
                   entity::Meteoroid,
-                  textures,
                   textures::Meteoroid);
     auto startingPosition = meteoroid.getPosition();
     auto desiredMeteoroidMove = -1; // Move the meteoroid 2 pixels away from starting point, from point of fire
@@ -571,9 +616,6 @@ TEST_CASE ("Shooting a meteoroid stright up moves corretly")
 
 TEST_CASE ("Shooting a meteoroid stright up causes them to scale down as they fly away")
 {
-    TextureHolder textures;
-    textures.load(textures::Meteoroid, "resources/meteoroid.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto meteoroidShootAngle = 180;
     auto meteoroidStartingPoint = resolution.y; //define the starting distance from centre;
@@ -582,7 +624,6 @@ TEST_CASE ("Shooting a meteoroid stright up causes them to scale down as they fl
                   meteoroidShootAngle,
                   0.5,
                   entity::Meteoroid,
-                  textures,
                   textures::Meteoroid);
     auto startingScale = meteoroid.getRadius();
     auto desiredMeteoroidMove = -10;
@@ -595,9 +636,6 @@ TEST_CASE ("Shooting a meteoroid stright up causes them to scale down as they fl
 
 TEST_CASE ("Shooting a meteoroid fired from the centre scales up as it moves outwards")
 {
-    TextureHolder textures;
-    textures.load(textures::Meteoroid, "resources/meteoroid.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     auto meteoroidShootAngle = 180;
     auto meteoroidStartingPoint = resolution.y / 2; //define the starting distance from centre;
@@ -606,7 +644,6 @@ TEST_CASE ("Shooting a meteoroid fired from the centre scales up as it moves out
                   meteoroidShootAngle,
                   0.5,
                   entity::Meteoroid,
-                  textures,
                   textures::Meteoroid);
     auto startingScale = meteoroid.getRadius();
     auto desiredMeteoroidMove = 10;
@@ -623,9 +660,6 @@ TEST_CASE ("Shooting a meteoroid fired from the centre scales up as it moves out
 
 TEST_CASE ("Creating an object enemy succeeds")
 {
-    TextureHolder textures;
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
             CHECK_NOTHROW(
             Enemy enemy(resolution,
@@ -633,7 +667,6 @@ TEST_CASE ("Creating an object enemy succeeds")
                         0,
                         0.5,
                         entity::Basic,
-                        textures,
                         textures::EnemyShipGrey,
                         MovementState::SpiralOut,
                         MovementDirection::Clockwise);
@@ -642,17 +675,12 @@ TEST_CASE ("Creating an object enemy succeeds")
 
 TEST_CASE ("Basic enemy starts at centre of screen by default")
 {
-
-    TextureHolder textures;
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     Enemy enemy(resolution,
                 0,
                 0,
                 0.5,
                 entity::Basic,
-                textures,
                 textures::EnemyShipGrey,
                 MovementState::SpiralOut,
                 MovementDirection::Clockwise);
@@ -663,17 +691,12 @@ TEST_CASE ("Basic enemy starts at centre of screen by default")
 
 TEST_CASE ("Instructing a basic enemy to move positions the transformation(linear motion)")
 {
-
-    TextureHolder textures;
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     Enemy enemy(resolution,
                 0,
                 0,
                 0.5,
                 entity::Basic,
-                textures,
                 textures::EnemyShipGrey,
                 MovementState::SpiralOut,
                 MovementDirection::Clockwise);
@@ -697,16 +720,12 @@ TEST_CASE ("Instructing a basic enemy to move positions the transformation(linea
 
 TEST_CASE ("Instructing an enemy to move positions the transformation (angular motion included)")
 {
-    TextureHolder textures;
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     Enemy enemy(resolution,
                 0,
                 0,
                 0.5,
                 entity::Basic,
-                textures,
                 textures::EnemyShipGrey,
                 MovementState::SpiralOut,
                 MovementDirection::Clockwise);
@@ -730,17 +749,12 @@ TEST_CASE ("Instructing an enemy to move positions the transformation (angular m
 
 TEST_CASE ("Enemy scale up as moving outwards away from ")
 {
-
-    TextureHolder textures;
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     Enemy enemy(resolution,
                 0,
                 0,
                 0.5,
                 entity::Basic,
-                textures,
                 textures::EnemyShipGrey,
                 MovementState::SpiralOut,
                 MovementDirection::Clockwise);
@@ -761,10 +775,6 @@ TEST_CASE ("Enemy scale up as moving outwards away from ")
 
 TEST_CASE ("Enemy scale down as it moves inwards towards centre")
 {
-
-    TextureHolder textures;
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     // Position the ship some distance away from the centre to start with
     auto startingShipRadius = resolution.y / 3;
@@ -774,7 +784,6 @@ TEST_CASE ("Enemy scale down as it moves inwards towards centre")
                 startingShipRadius,
                 0.5,
                 entity::Basic,
-                textures,
                 textures::EnemyShipGrey,
                 MovementState::SpiralOut,
                 MovementDirection::Clockwise);
@@ -792,16 +801,12 @@ TEST_CASE ("Enemy scale down as it moves inwards towards centre")
 
 TEST_CASE ("Killing the enemy ship resets the object")
 {
-    TextureHolder textures;
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
-
     auto resolution = sf::Vector2i{1920, 1080};
     Enemy enemy(resolution,
                 0,
                 0,
                 0.5,
                 entity::Basic,
-                textures,
                 textures::EnemyShipGrey,
                 MovementState::SpiralOut,
                 MovementDirection::Clockwise);
@@ -838,15 +843,14 @@ TEST_CASE ("Shield Spawns at player ship location"){
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); //move playerShip to origin
-    Shield shield(resolution, shipPathRadius, 0, shipScale, textures, playerShip);
-    shield.update();
+    Shield shield(resolution, shipPathRadius, 0, shipScale, textures);
+    shield.move(SpriteState{playerShip});
     auto endShipPosition = playerShip.getPosition();
     auto endShieldPosition = shield.getSprite().getPosition();
-    CHECK(roundf(endShieldPosition.x)==roundf(endShieldPosition.x));
-            CHECK(roundf(endShieldPosition.y)==roundf(endShieldPosition.y));
+    CHECK(roundf(endShieldPosition.x)==roundf(endShipPosition.x));
+            CHECK(roundf(endShieldPosition.y)==roundf(endShipPosition.y));
 }
 
 
@@ -863,32 +867,77 @@ TEST_CASE ("Shield follows the player ship location"){
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     playerShip.update(); //move playerShip to origin
-    Shield shield(resolution, shipPathRadius, 0, shipScale, textures, playerShip);
-    shield.update();
+    Shield shield(resolution, shipPathRadius, 0, shipScale, textures);
+    shield.move(SpriteState{playerShip});
     auto moveAngle = 90;
     playerShip.setMove(moveAngle);
     playerShip.update();
-    shield.update();
+    shield.move(SpriteState{playerShip});
     auto endShipPosition = playerShip.getPosition();
     auto endShieldPosition = shield.getSprite().getPosition();
-            CHECK(roundf(endShieldPosition.x)==roundf(endShieldPosition.x));
-            CHECK(roundf(endShieldPosition.y)==roundf(endShieldPosition.y));}
+            CHECK(roundf(endShieldPosition.x)==roundf(endShipPosition.x));
+            CHECK(roundf(endShieldPosition.y)==roundf(endShipPosition.y));}
 
 //This marks the end of the movement tests for all movable objects
 
 ////////////////////////////////////////////////////////////
-///  Explosion tests
+///  Sprite batch tests
 ////////////////////////////////////////////////////////////
 
-TEST_CASE("Explosion spawns at desired location")
+TEST_CASE ("A sprite batch puts each texture's sprites in one batch, in the order the textures were added")
 {
     TextureHolder textures;
-    textures.load(textures::Explosion, "resources/explosion.png");
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
+    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
+    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
+    const auto &shipTexture = textures.get(textures::PlayerShip);
+    const auto &bulletTexture = textures.get(textures::BulletPlayer);
+
+    SpriteBatch batch;
+    batch.add(bulletTexture, {0, 0, 16, 16}, {100, 100}, {1, 1}, 0, sf::Color::White);
+    batch.add(shipTexture, {0, 0, 32, 32}, {200, 100}, {1, 1}, 0, sf::Color::White);
+    batch.add(bulletTexture, {16, 0, 16, 16}, {300, 100}, {1, 1}, 0, sf::Color::White);
+            CHECK(batch.getSpriteCount() == 3);
+            REQUIRE(batch.getBatchCount() == 2);
+            CHECK(batch.getVertices(0).getVertexCount() == 8);
+            CHECK(batch.getVertices(1).getVertexCount() == 4);
+            CHECK(batch.getVertices(0)[4].texCoords == sf::Vector2f(16, 0));
+
+    batch.clear();
+            CHECK(batch.getSpriteCount() == 0);
+            CHECK(batch.getBatchCount() == 0);
+}
+
+TEST_CASE ("A batched quad covers the same area as the sprite it replaces")
+{
+    TextureHolder textures;
+    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
+    const auto &texture = textures.get(textures::PlayerShip);
+    auto frame = sf::IntRect{0, 0, 40, 24};
+
+    sf::Sprite sprite(texture, frame);
+    sprite.setOrigin(frame.width / 2.f, frame.height / 2.f);
+    sprite.setPosition(640, 360);
+    sprite.setScale(1.5f, 0.5f);
+    sprite.setRotation(30);
+    SpriteBatch batch;
+    batch.add(texture, frame, sprite.getPosition(), sprite.getScale(), sprite.getRotation(), sf::Color::White);
+
+    auto spriteBounds = sprite.getGlobalBounds();
+    auto quadBounds = batch.getVertices(0).getBounds();
+            CHECK(std::abs(quadBounds.left - spriteBounds.left) < 0.1f);
+            CHECK(std::abs(quadBounds.top - spriteBounds.top) < 0.1f);
+            CHECK(std::abs(quadBounds.width - spriteBounds.width) < 0.1f);
+            CHECK(std::abs(quadBounds.height - spriteBounds.height) < 0.1f);
+}
+
+////////////////////////////////////////////////////////////
+///  Explosion tests
+////////////////////////////////////////////////////////////
 
+TEST_CASE("Explosion spawns at desired location")
+{
     auto resolution = sf::Vector2i{1920, 1080};
     auto spawnRadius = 100;
     auto spawnAngle = 100;
@@ -900,7 +949,6 @@ TEST_CASE("Explosion spawns at desired location")
                 spawnAngle,
                 spawnScale,
                 entity::Basic,
-                textures,
                 textures::EnemyShipGrey,
                 MovementState::SpiralOut,
                 MovementDirection::Clockwise);
@@ -911,7 +959,6 @@ TEST_CASE("Explosion spawns at desired location")
                         enemy.getAngle(),
                         enemy.getScale().x*2,
                         entity::Explosion,
-                        textures,
                         textures::Explosion};
 
 
@@ -927,24 +974,28 @@ TEST_CASE("Explosion spawns at desired location")
 TEST_CASE("Two objects on top of each other report a collision")
 {
     auto resolution = sf::Vector2i{1920, 1080};
-    TextureHolder textures;
 
-    sf::Sprite sprite1;
-    sprite1.setPosition(10,10);
-
-    sf::Sprite sprite2;
-    sprite2.setPosition(10,10);
-    // Each sprite needs a texture so it can have a size associated with it to simulate the collision detection
-
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
-    sprite1.setTexture(textures.get(textures::EnemyShipGrey));
-    sprite2.setTexture(textures.get(textures::EnemyShipGrey));
+    // Two identical enemies, moved to the same location
+    Enemy enemy1(resolution,
+                 300,
+                 45,
+                 0.5,
+                 entity::Basic,
+                 textures::EnemyShipGrey,
+                 MovementState::SpiralOut,
+                 MovementDirection::Clockwise);
+    Enemy enemy2(resolution,
+                 300,
+                 45,
+                 0.5,
+                 entity::Basic,
+                 textures::EnemyShipGrey,
+                 MovementState::SpiralOut,
+                 MovementDirection::Clockwise);
+    enemy1.update();
+    enemy2.update();
 
     // The EntityController requires the playerShip object as part of its constructor
-
-    textures.load(textures::BulletPlayer, "resources/bullet_player.png");
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
     const auto shipPathRadius = (resolution.y / 2) - (resolution.y * shipPathRadiusPadding);
@@ -952,35 +1003,40 @@ TEST_CASE("Two objects on top of each other report a collision")
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     // EntityController needs a score and speedModifier
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     float speedModifier = 1;
-    EntityController entityController(resolution,playerShip,textures,score,speedModifier);
-    // We can now check that the two sprites, at the same location, return a collision
-    CHECK(entityController.collides(sprite1,sprite2));
+    EntityController entityController(resolution,playerShip,score,clock,speedModifier);
+    // We can now check that the two entities, at the same location, return a collision
+    CHECK(entityController.collides(enemy1,enemy2));
 }
 
 TEST_CASE("Two objects on that are not on top of each other do not report a collision"){
     auto resolution = sf::Vector2i{1920, 1080};
-    TextureHolder textures;
-
-    sf::Sprite sprite1;
-    sprite1.setPosition(10,10);
 
-    sf::Sprite sprite2;
-    //set the second sprite far away from the first
-    sprite2.setPosition(900,900);
-    //each sprite needs a texture so it can have a size associated with it to simulate the collision detection
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
-    sprite1.setTexture(textures.get(textures::EnemyShipGrey));
-    sprite2.setTexture(textures.get(textures::EnemyShipGrey));
+    // Two enemies on opposite sides of the screen
+    Enemy enemy1(resolution,
+                 300,
+                 45,
+                 0.5,
+                 entity::Basic,
+                 textures::EnemyShipGrey,
+                 MovementState::SpiralOut,
+                 MovementDirection::Clockwise);
+    Enemy enemy2(resolution,
+                 300,
+                 135,
+                 0.5,
+                 entity::Basic,
+                 textures::EnemyShipGrey,
+                 MovementState::SpiralOut,
+                 MovementDirection::Clockwise);
+    enemy1.update();
+    enemy2.update();
 
     // The EntityController requires the playerShip object as part of its constructor so we have to substantiate one
-
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
     const auto shipPathRadius = (resolution.y / 2) - (resolution.y * shipPathRadiusPadding);
@@ -988,14 +1044,116 @@ TEST_CASE("Two objects on that are not on top of each other do not report a coll
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     // Lastly, the EntityController needs a score and speedModifier
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     float speedModifier = 1;
-    EntityController entityController(resolution,playerShip,textures,score,speedModifier);
-    // We can now check that the two sprites, at different locations, do not report true
-            CHECK(!entityController.collides(sprite1,sprite2));
+    EntityController entityController(resolution,playerShip,score,clock,speedModifier);
+    // We can now check that the two entities, at different locations, do not report true
+            CHECK(!entityController.collides(enemy1,enemy2));
+}
+
+TEST_CASE("Entity bounds are the texture frame at the entity's scale")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    Enemy enemy(resolution,
+                0,
+                0,
+                0.5,
+                entity::Basic,
+                textures::EnemyShipGrey,
+                MovementState::SpiralOut,
+                MovementDirection::Clockwise);
+    auto frame = textures::getFrame(textures::EnemyShipGrey);
+            CHECK(enemy.getBoundsSize().x == doctest::Approx(frame.width * 0.5));
+            CHECK(enemy.getBoundsSize().y == doctest::Approx(frame.height * 0.5));
+}
+
+TEST_CASE("Rotating an entity by 90 degrees swaps the width and height of its bounds")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    auto shipPathRadius = (resolution.y / 2) - (resolution.y * 0.05f);
+    PlayerShip playerShip(resolution,
+                          shipPathRadius,
+                          0,
+                          1,
+                          entity::PlayerShip);
+    playerShip.setMove(90);
+    playerShip.update();
+    auto frame = textures::getFrame(textures::PlayerShip);
+            CHECK(playerShip.getBoundsSize().x == doctest::Approx(frame.height));
+            CHECK(playerShip.getBoundsSize().y == doctest::Approx(frame.width));
+}
+
+TEST_CASE("An entity's collision circle follows it when it moves")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    Enemy enemy(resolution,
+                300,
+                45,
+                0.5,
+                entity::Basic,
+                textures::EnemyShipGrey,
+                MovementState::SpiralOut,
+                MovementDirection::Clockwise);
+    enemy.setMove(10, 50);
+    enemy.update();
+    auto bounds = enemy.getBoundsSize();
+    CHECK(enemy.getCollisionCentre() == enemy.getPosition());
+    CHECK(enemy.getCollisionRadius() == doctest::Approx((bounds.x + bounds.y) / 4.2f));
+
+    // A reset enemy is shrunk to nothing, so it cannot be hit again
+    enemy.reset();
+    CHECK(enemy.getCollisionRadius() == 0);
+}
+
+TEST_CASE("Two player bullets on one enemy in the same step kill it once")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    // The playerShip's bullets spawn at the distance a spiralling-in enemy spawns at
+    PlayerShip playerShip(resolution, (resolution.y / 3) + 40, 0, 0.22f, entity::PlayerShip);
+    SimulationClock clock;
+    Score score(clock);
+    EntityController entityController(resolution, playerShip, score, clock, 1);
+    entityController.spawnBasicEnemy(entity::Basic, textures::EnemyShipGrey,
+                                     MovementDirection::Clockwise, MovementState::SpiralIn);
+    REQUIRE(entityController.getEnemies().size() == 1);
+
+    // Turn onto the enemy (it spawns opposite the playerShip), fire twice, and turn back
+    playerShip.setMove(180);
+    playerShip.move();
+    playerShip.setShoot();
+    entityController.shoot();
+    entityController.shoot();
+    REQUIRE(entityController.getBulletsPlayer().size() == 2);
+    playerShip.setMove(180);
+    playerShip.move();
+
+    entityController.checkCollisions();
+            CHECK(entityController.getEnemies().empty());
+            CHECK(entityController.getExplosions().size() == 1);
+            CHECK(score.getEnemiesKilled() == 1);
+            CHECK(entityController.getBulletsPlayer().size() == 1);
+}
+
+TEST_CASE("An enemy circling an offset centre reports its depth from the cached centre distance")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    Enemy enemy(resolution,
+                200,
+                0,
+                0.5,
+                entity::Basic,
+                textures::EnemyShipGrey,
+                MovementState::CircleOffsetRight,
+                MovementDirection::Clockwise);
+    enemy.setMove(5, 0, {30, 40}); // Circle origin 50 pixels from the centre of the screen
+    enemy.update();
+    CHECK(enemy.getDistanceFromCentre() == doctest::Approx(200 + 50 - enemy.getBoundsSize().y / 2));
+
+    auto offset = enemy.getPosition() - sf::Vector2f(resolution.x / 2, resolution.y / 2);
+    CHECK(enemy.getRadius() == doctest::Approx(std::sqrt(offset.x * offset.x + offset.y * offset.y)));
 }
 
 ////////////////////////////////////////////////////////////
@@ -1004,7 +1162,8 @@ TEST_CASE("Two objects on that are not on top of each other do not report a coll
 
 TEST_CASE("Score object correctly calculates game score for killing enemy")
 {
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     score.reset();
     //simulate killing 3 enemies and check reports the correct score
     score.incrementEnemiesKilled(entity::Basic);
@@ -1016,7 +1175,8 @@ TEST_CASE("Score object correctly calculates game score for killing enemy")
 
 TEST_CASE("Score object correctly calculates records number of enemies killed")
 {
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     score.reset();
     //simulate killing 3 enemies and check reports the correct score
     score.incrementEnemiesKilled(entity::Basic);
@@ -1028,7 +1188,8 @@ TEST_CASE("Score object correctly calculates records number of enemies killed")
 
 TEST_CASE("Score object correctly counts the number of bullets fired")
 {
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     score.reset();
     auto expectedBullets=0;
     for(int i =0; i<10;i++){
@@ -1040,7 +1201,8 @@ TEST_CASE("Score object correctly counts the number of bullets fired")
 
 TEST_CASE("Score object correctly calculates player accuracy")
 {
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     score.reset();
     auto bulletesFired=0.0f;
     //loop used to simulate shooting 5 bullets
@@ -1062,43 +1224,40 @@ TEST_CASE("Score object correctly calculates player accuracy")
 
 TEST_CASE("Score object correctly recoreds player life length")
 {
-    sf::Clock testClock;
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     score.reset();
-    testClock.restart();
-    std::this_thread::sleep_for(std::chrono::milliseconds(100)); //put the sleep in a thread to not slow down tests
+    for (auto i = 0; i < 90; i++) // 1.5 seconds of game time
+        clock.tick();
     auto playerLife = score.getTimeAlive();
-    auto expectedLife = testClock.getElapsedTime().asSeconds();
-            CHECK((roundf(playerLife * 1000) / 1000)==(roundf(expectedLife * 1000) / 1000));
+            CHECK(playerLife == doctest::Approx(1.5));
 }
 
 TEST_CASE("Score object correctly recoreds longest player life length")
 {
-    sf::Clock testClock;
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     score.reset();
-    testClock.restart();
-    auto longestMeasuredLife = 0.0f;
-    //create a score object, kill the player 3 times with 3 diffrent delays between them
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
-    score.resetLifeTimer();
-    if(testClock.getElapsedTime().asSeconds()>longestMeasuredLife)
-        longestMeasuredLife = testClock.getElapsedTime().asSeconds();
-    testClock.restart();
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
-    score.resetLifeTimer();
-    if(testClock.getElapsedTime().asSeconds()>longestMeasuredLife)
-        longestMeasuredLife = testClock.getElapsedTime().asSeconds();
-    testClock.restart();
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    score.resetLifeTimer();
-    if(testClock.getElapsedTime().asSeconds()>longestMeasuredLife)
-        longestMeasuredLife = testClock.getElapsedTime().asSeconds();
-    testClock.restart();
-
-    auto longestCalculatedPlayerLife = score.getLongestTimeAlive();
-    //rounding is done to 3 decimal places
-            CHECK((roundf(longestCalculatedPlayerLife * 1000) / 1000)==(roundf(longestMeasuredLife * 1000) / 1000));
+    //kill the player 3 times, after 3 diffrent lengths of game time
+    for (auto ticks : {30, 120, 60})
+    {
+        for (auto i = 0; i < ticks; i++)
+            clock.tick();
+        score.resetLifeTimer();
+    }
+            CHECK(score.getLongestTimeAlive() == doctest::Approx(2));
+}
+
+TEST_CASE("Score object awards the survival bonus once per second of game time")
+{
+    SimulationClock clock;
+    Score score(clock);
+    for (auto i = 0; i < 60 * 3 + 5; i++)
+    {
+        clock.tick();
+        score.update();
+    }
+            CHECK(score.getScore() == 150);
 }
 
 ////////////////////////////////////////////////////////////
@@ -1135,6 +1294,35 @@ TEST_CASE("Radian to Degrees conversion is correct")
             CHECK(round(common::radToDegree(inputRadian)*1000)/1000==round(expectedDegree*1000)/1000);
 }
 
+TEST_CASE("Angle wrapping handles angles more than one turn out of range")
+{
+    CHECK(fastmath::wrapDegrees(1000) == doctest::Approx(280));
+    CHECK(fastmath::wrapDegrees(-1000) == doctest::Approx(80));
+    CHECK(fastmath::wrapDegrees(-1e-6f) < 360);
+}
+
+TEST_CASE("Fast sine and cosine agree with the standard library to within the documented bound")
+{
+    // Not a whole fraction of a degree, so the angles do not all reduce to the same few points
+    for (auto degrees = -720.f; degrees <= 720.f; degrees += 0.01f)
+    {
+        float sine, cosine;
+        fastmath::sinCosDegrees(degrees, sine, cosine);
+        CHECK(std::fabs(sine - std::sin(degrees * M_PI / 180)) < 3e-7);
+        CHECK(std::fabs(cosine - std::cos(degrees * M_PI / 180)) < 3e-7);
+    }
+}
+
+TEST_CASE("Fast atan2 agrees with the standard library in every octant")
+{
+    for (auto degrees = -179.5f; degrees < 180.f; degrees += 0.5f)
+    {
+        auto x = 250 * std::cos(degrees * M_PI / 180);
+        auto y = 250 * std::sin(degrees * M_PI / 180);
+        CHECK(std::fabs(fastmath::atan2Degrees(y, x) - std::atan2(y, x) * 180 / M_PI) < 2e-4);
+    }
+}
+
 TEST_CASE("String padding correctly appends chars to an integer")
 {
     auto inputInt = 10;
@@ -1144,16 +1332,570 @@ TEST_CASE("String padding correctly appends chars to an integer")
     CHECK(common::padIntToString(inputInt,desiredStringLength,charPadding)==expectedString);
 }
 
+////////////////////////////////////////////////////////////
+///  Simulation clock tests
+////////////////////////////////////////////////////////////
+
+TEST_CASE("A tick timer measures the steps of its simulation clock")
+{
+    SimulationClock clock;
+    clock.tick();
+    TickTimer timer(clock);
+            CHECK(timer.getElapsedTicks() == 0);
+    for (auto i = 0; i < 30; i++)
+        clock.tick();
+            CHECK(timer.getElapsedTicks() == 30);
+            CHECK(timer.getElapsedTime() == doctest::Approx(0.5));
+            CHECK(clock.getTicks() == 31);
+    timer.restart();
+            CHECK(timer.getElapsedTicks() == 0);
+}
+
+TEST_CASE("An enemy's timers count its updates, not wall time")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    Enemy enemy(resolution,
+                0,
+                0,
+                0.5,
+                entity::Basic,
+                textures::EnemyShipGrey,
+                MovementState::SpiralOut,
+                MovementDirection::Clockwise);
+    for (auto i = 0; i < 120; i++)
+        enemy.update();
+            CHECK(enemy.getAliveTimeElapsedTime() == doctest::Approx(2));
+    enemy.resetShootTimer();
+    enemy.update();
+            CHECK(enemy.getShootTimerElapsedTime() == doctest::Approx(1 / 60.f));
+            CHECK(enemy.getAliveTimeElapsedTime() == doctest::Approx(121 / 60.f));
+}
+
+////////////////////////////////////////////////////////////
+///  Simulation thread tests
+////////////////////////////////////////////////////////////
+
+TEST_CASE ("A TripleBuffer hands the reader only the newest published value")
+{
+    TripleBuffer<int> buffer;
+            CHECK_FALSE(buffer.update());
+    buffer.getWriteBuffer() = 1;
+    buffer.publish();
+    buffer.getWriteBuffer() = 2;
+    buffer.publish();
+            CHECK(buffer.update());
+            CHECK(buffer.getReadBuffer() == 2);
+            CHECK_FALSE(buffer.update());
+            CHECK(buffer.getReadBuffer() == 2);
+}
+
+TEST_CASE ("Values published by another thread arrive whole and in order")
+{
+    TripleBuffer<std::vector<int>> buffer;
+    auto count = 20000;
+    std::thread writer([&buffer, count] {
+        for (auto i = 1; i <= count; i++)
+        {
+            buffer.getWriteBuffer().assign(64, i);
+            buffer.publish();
+        }
+    });
+
+    auto last = 0;
+    auto whole = true;
+    auto inOrder = true;
+    while (last < count)
+    {
+        if (!buffer.update())
+            continue;
+        const auto &value = buffer.getReadBuffer();
+        whole = whole && std::all_of(value.begin(), value.end(), [&value](int element) {return element == value[0];});
+        inOrder = inOrder && value[0] > last;
+        last = value[0];
+    }
+    writer.join();
+            CHECK(whole);
+            CHECK(inOrder);
+}
+
+TEST_CASE ("Each press of the fire button is taken by the simulation once")
+{
+    PlayerInput input;
+            CHECK_FALSE(input.takeShot());
+    input.shoot();
+    input.shoot();
+            CHECK(input.takeShot());
+            CHECK(input.takeShot());
+            CHECK_FALSE(input.takeShot());
+}
+
+TEST_CASE ("A Simulation snapshot holds every entity, the playerShip and the score")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    const auto shipPathRadius = (resolution.y / 2) - (resolution.y * 0.05f);
+    SimulationClock clock;
+    Score score(clock);
+    Simulation simulation(resolution, shipPathRadius, 0.22f, score, clock, 0.35f, Random{5});
+    simulation.getInput().setMove(260);
+    for (auto i = 0; i < 600; i++)
+        simulation.step();
+
+    RenderSnapshot snapshot;
+    simulation.capture(snapshot);
+    const auto &entityController = simulation.getEntityController();
+    const auto &playerShip = simulation.getPlayerShip();
+    auto numberOfEntities = entityController.getEnemies().size()
+                            + entityController.getBulletsEnemy().size()
+                            + entityController.getBulletsPlayer().size()
+                            + entityController.getMeteoroids().size()
+                            + entityController.getExplosions().size();
+            CHECK(numberOfEntities > 0);
+            CHECK(snapshot.sprites.size() == numberOfEntities);
+            CHECK(snapshot.playerShip.position == playerShip.getPosition());
+            CHECK(snapshot.lives == playerShip.getLives());
+            CHECK(snapshot.score == score.getScore());
+            CHECK(snapshot.ticks == 600);
+            CHECK(snapshot.gameState == simulation.getGameState());
+}
+
+////////////////////////////////////////////////////////////
+///  Batch runner tests
+////////////////////////////////////////////////////////////
+
+TEST_CASE ("Every job runs exactly once, including jobs submitted by jobs")
+{
+    JobSystem jobs(3);
+    auto numberOfJobs = 500;
+    std::vector<std::atomic<int>> runs(numberOfJobs * 2);
+    for (auto &count : runs)
+        count = 0;
+    for (auto i = 0; i < numberOfJobs; i++)
+    {
+        jobs.submit([i, numberOfJobs, &runs, &jobs] {
+            runs[i]++;
+            jobs.submit([i, numberOfJobs, &runs] {runs[numberOfJobs + i]++;});
+        });
+    }
+    jobs.wait();
+            CHECK(std::all_of(runs.begin(), runs.end(), [](const std::atomic<int> &count) {return count == 1;}));
+}
+
+TEST_CASE ("A batch of games gives the same results on any number of threads")
+{
+    BatchRunner runner(7, BatchRunner::RandomInput, 1200);
+    JobSystem oneThread(1);
+    JobSystem fourThreads(4);
+    auto results = runner.run(6, oneThread);
+    auto parallelResults = runner.run(6, fourThreads);
+
+            REQUIRE(results.size() == 6);
+            REQUIRE(parallelResults.size() == 6);
+    for (auto game = 0u; game < results.size(); game++)
+    {
+                CHECK(parallelResults[game].game == game);
+                CHECK(parallelResults[game].outcome == results[game].outcome);
+                CHECK(parallelResults[game].score == results[game].score);
+                CHECK(parallelResults[game].enemiesKilled == results[game].enemiesKilled);
+                CHECK(parallelResults[game].ticks == results[game].ticks);
+                CHECK(results[game].ticks <= 1200);
+    }
+}
+
+TEST_CASE ("A parallel for covers every index exactly once, however the range is split")
+{
+    JobSystem jobs(3);
+    for (auto count : {0u, 1u, 7u, 1000u})
+    {
+        std::vector<std::atomic<int>> runs(count);
+        for (auto &run : runs)
+            run = 0;
+        jobs.parallelFor(count, 4, [&runs](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; i++)
+                runs[i]++;
+        });
+                CHECK(std::all_of(runs.begin(), runs.end(), [](const std::atomic<int> &run) {return run == 1;}));
+    }
+}
+
+TEST_CASE ("Parallel fors run from inside jobs cover every index, and all finish")
+{
+    JobSystem jobs(3);
+    auto numberOfLoops = 20;
+    auto count = 1000u;
+    std::vector<std::atomic<int>> runs(numberOfLoops * count);
+    for (auto &run : runs)
+        run = 0;
+    for (auto loop = 0; loop < numberOfLoops; loop++)
+    {
+        jobs.submit([loop, count, &runs, &jobs] {
+            jobs.parallelFor(count, 4, [loop, count, &runs](std::size_t begin, std::size_t end) {
+                for (auto i = begin; i < end; i++)
+                    runs[loop * count + i]++;
+            });
+        });
+    }
+    jobs.wait();
+            CHECK(std::all_of(runs.begin(), runs.end(), [](const std::atomic<int> &run) {return run == 1;}));
+}
+
+TEST_CASE ("A game plays out the same with its entity loops spread across threads")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    JobSystem jobs(3);
+    SimulationClock clock, parallelClock;
+    Score score(clock), parallelScore(parallelClock);
+    Simulation simulation(resolution, 486, 0.22f, score, clock, 0.35f, Random{11});
+    Simulation parallelSimulation(resolution, 486, 0.22f, parallelScore, parallelClock, 0.35f, Random{11});
+    parallelSimulation.setJobSystem(&jobs, 0); // Every loop goes to the job system
+
+    for (auto tick = 0; tick < 1200 && simulation.getGameState() == game::GameState::Playing; tick++)
+    {
+        for (auto input : {&simulation.getInput(), &parallelSimulation.getInput()})
+        {
+            input->setMove((tick % 240 < 120) ? 260.f : -260.f);
+            if (tick % 10 == 0)
+                input->shoot();
+        }
+        simulation.step();
+        parallelSimulation.step();
+    }
+
+    const auto &enemies = simulation.getEntityController().getEnemies();
+    const auto &parallelEnemies = parallelSimulation.getEntityController().getEnemies();
+            CHECK(parallelSimulation.getGameState() == simulation.getGameState());
+            CHECK(parallelScore.getScore() == score.getScore());
+            CHECK(parallelScore.getEnemiesKilled() == score.getEnemiesKilled());
+            REQUIRE(parallelEnemies.size() == enemies.size());
+    for (auto i = 0u; i < enemies.size(); i++)
+                CHECK(parallelEnemies[i].getPosition() == enemies[i].getPosition());
+}
+
+TEST_CASE ("Two player bullets on one enemy kill it once when the hits are found across threads")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    JobSystem jobs(3);
+    PlayerShip playerShip(resolution, (resolution.y / 3) + 40, 0, 0.22f, entity::PlayerShip);
+    SimulationClock clock;
+    Score score(clock);
+    EntityController entityController(resolution, playerShip, score, clock, 1);
+    entityController.setJobSystem(&jobs, 1); // The bullets' grid queries go to the job system
+    entityController.spawnBasicEnemy(entity::Basic, textures::EnemyShipGrey,
+                                     MovementDirection::Clockwise, MovementState::SpiralIn);
+
+    playerShip.setMove(180);
+    playerShip.move();
+    playerShip.setShoot();
+    entityController.shoot();
+    entityController.shoot();
+    REQUIRE(entityController.getBulletsPlayer().size() == 2);
+    playerShip.setMove(180);
+    playerShip.move();
+
+    entityController.checkCollisions();
+            CHECK(entityController.getEnemies().empty());
+            CHECK(entityController.getExplosions().size() == 1);
+            CHECK(score.getEnemiesKilled() == 1);
+            CHECK(entityController.getBulletsPlayer().size() == 1);
+}
+
+TEST_CASE ("Stress mode keeps the swarm topped up, and the game does not end")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    SimulationClock clock;
+    Score score(clock);
+    Simulation simulation(resolution, 486, 0.22f, score, clock, 0.35f, Random{3});
+    StressSettings stress;
+            CHECK_FALSE(stress.isEnabled());
+    stress.enemies = 300;
+    stress.bullets = 2000;
+    simulation.setStressMode(stress);
+
+    const auto &entityController = simulation.getEntityController();
+    auto mostBullets = std::size_t{0};
+    for (auto tick = 0; tick < 600; tick++)
+    {
+        simulation.step();
+                REQUIRE(entityController.getEnemies().size() <= stress.enemies);
+        mostBullets = std::max(mostBullets, entityController.getBulletsEnemy().size());
+    }
+            CHECK(entityController.getEnemies().size() > stress.enemies * 9 / 10);
+            CHECK(mostBullets == stress.bullets);
+            CHECK(simulation.getGameState() == game::GameState::Playing);
+            CHECK(simulation.getPlayerShip().getLives() > 0);
+}
+
+////////////////////////////////////////////////////////////
+///  Profiler tests
+////////////////////////////////////////////////////////////
+
+TEST_CASE ("A profiler gives the minimum, mean and 99th percentile of a phase")
+{
+    Profiler profiler(100);
+    for (auto i = 100; i > 0; i--)
+        profiler.record(Profiler::Render, static_cast<float>(i));
+    auto statistics = profiler.getStatistics(Profiler::Render);
+            CHECK(statistics.samples == 100);
+            CHECK(statistics.minimum == doctest::Approx(1));
+            CHECK(statistics.mean == doctest::Approx(50.5));
+            CHECK(statistics.percentile99 == doctest::Approx(99));
+            CHECK(profiler.getStatistics(Profiler::Display).samples == 0);
+}
+
+TEST_CASE ("A profiler only keeps the most recent timings of each phase")
+{
+    Profiler profiler(10);
+    for (auto i = 0; i < 10; i++)
+        profiler.record(Profiler::Update, 1000);
+    for (auto i = 0; i < 10; i++)
+        profiler.record(Profiler::Update, 5);
+    auto statistics = profiler.getStatistics(Profiler::Update);
+            CHECK(statistics.samples == 10);
+            CHECK(statistics.percentile99 == doctest::Approx(5));
+}
+
+TEST_CASE ("A profiler scope records one timing when it ends, and the report lists timed phases")
+{
+    Profiler profiler;
+    {
+        Profiler::Scope timer(profiler, Profiler::CheckCollisions);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    auto statistics = profiler.getStatistics(Profiler::CheckCollisions);
+            CHECK(statistics.samples == 1);
+            CHECK(statistics.minimum >= 2000);
+
+    std::ostringstream report;
+    profiler.report(report);
+            CHECK(report.str().find("checkCollisions") != std::string::npos);
+            CHECK(report.str().find("render") == std::string::npos);
+}
+
+////////////////////////////////////////////////////////////
+///  Random stream tests
+////////////////////////////////////////////////////////////
+
+TEST_CASE("Two random streams with the same seed produce the same sequence")
+{
+    Random random1(2017);
+    Random random2(2017);
+    for (auto i = 0; i < 100; i++)
+        CHECK(random1.next() == random2.next());
+}
+
+TEST_CASE("Random substreams are repeatable, and differ from each other")
+{
+    Random random(2017);
+    auto stream1 = random.substream(1);
+    auto stream1Again = random.substream(1);
+    auto stream2 = random.substream(2);
+    random.next(); // Drawing from the parent does not change its substreams
+    auto stream1Later = random.substream(1);
+    auto firstValue = stream1.next();
+    CHECK(firstValue == stream1Again.next());
+    CHECK(firstValue == stream1Later.next());
+    CHECK(firstValue != stream2.next());
+}
+
+TEST_CASE("Random integers and floats stay inside the requested range")
+{
+    Random random;
+    for (auto i = 0; i < 1000; i++)
+    {
+        auto integer = random.nextInt(360);
+        auto real = random.nextFloat(0.8f, 2.f);
+        CHECK(integer >= 0);
+        CHECK(integer < 360);
+        CHECK(real >= 0.8f);
+        CHECK(real < 2.f);
+    }
+}
+
+////////////////////////////////////////////////////////////
+///  Entity pool tests
+////////////////////////////////////////////////////////////
+
+TEST_CASE("An entity pool refuses to spawn past its capacity, and does not reallocate")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    EntityPool<Bullet> bullets(2);
+    CHECK(bullets.spawn(resolution, 100, 0, 1, entity::PlayerBullet, textures::BulletPlayer));
+    auto firstBullet = &*bullets.begin();
+    CHECK(bullets.spawn(resolution, 100, 90, 1, entity::PlayerBullet, textures::BulletPlayer));
+    CHECK_FALSE(bullets.spawn(resolution, 100, 180, 1, entity::PlayerBullet, textures::BulletPlayer));
+    CHECK(bullets.size() == 2);
+    CHECK(bullets.overflows() == 1);
+    CHECK(firstBullet == &*bullets.begin());
+}
+
+TEST_CASE("Erasing from an entity pool moves the last entity into the freed slot")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    EntityPool<Bullet> bullets(3);
+    bullets.spawn(resolution, 100, 0, 1, entity::PlayerBullet, textures::BulletPlayer);
+    bullets.spawn(resolution, 100, 90, 1, entity::PlayerBullet, textures::BulletPlayer);
+    bullets.spawn(resolution, 100, 180, 1, entity::PlayerBullet, textures::BulletPlayer);
+    auto next = bullets.erase(bullets.begin());
+    CHECK(bullets.size() == 2);
+    CHECK(next->getAngle() == 180);
+}
+
+TEST_CASE("An entity pool records the most entities alive at once")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    EntityPool<Bullet> bullets(10);
+    for (auto i = 0; i < 4; i++)
+        bullets.spawn(resolution, 100, i * 10, 1, entity::PlayerBullet, textures::BulletPlayer);
+    bullets.removeIf([](const Bullet &bullet) {return bullet.getAngle() < 25;});
+    bullets.spawn(resolution, 100, 50, 1, entity::PlayerBullet, textures::BulletPlayer);
+    CHECK(bullets.size() == 2);
+    CHECK(bullets.highWaterMark() == 4);
+}
+
+TEST_CASE("Pooled entities are plain values, with no virtual dispatch")
+{
+    CHECK_FALSE(std::is_polymorphic<Bullet>::value);
+    CHECK_FALSE(std::is_polymorphic<Meteoroid>::value);
+    CHECK_FALSE(std::is_polymorphic<Explosion>::value);
+    CHECK_FALSE(std::is_polymorphic<Enemy>::value);
+    CHECK_FALSE(std::is_polymorphic<PlayerShip>::value);
+}
+
+////////////////////////////////////////////////////////////
+///  Polar grid tests
+////////////////////////////////////////////////////////////
+
+// The indices of the entities in the runs found by queryRanges(), in order
+std::vector<unsigned int> queryIndices(const PolarGrid &grid, sf::Vector2f position, float radius)
+{
+    std::vector<PolarGrid::range> ranges;
+    grid.queryRanges(position, radius, ranges);
+    std::vector<unsigned int> indices;
+    for (const auto &run : ranges)
+        for (auto position = run.begin; position < run.end; position++)
+            indices.push_back(grid.getSortedIndex(position));
+    return indices;
+}
+
+TEST_CASE("A polar grid query returns entities near the circle, and not those on the far side")
+{
+    auto centre = sf::Vector2f{960, 540};
+    PolarGrid grid(centre, 540);
+    grid.insert(0, {centre.x + 300, centre.y}, 20);      // Right of centre
+    grid.insert(1, {centre.x + 310, centre.y + 10}, 20); // Right, just beside it
+    grid.insert(2, {centre.x - 300, centre.y}, 20);      // Left of centre
+    grid.insert(3, {centre.x, centre.y + 100}, 20);      // Below, closer in
+    grid.build();
+
+    auto candidates = queryIndices(grid, {centre.x + 305, centre.y + 5}, 5);
+    CHECK(std::find(candidates.begin(), candidates.end(), 0) != candidates.end());
+    CHECK(std::find(candidates.begin(), candidates.end(), 1) != candidates.end());
+    CHECK(std::find(candidates.begin(), candidates.end(), 2) == candidates.end());
+    CHECK(std::find(candidates.begin(), candidates.end(), 3) == candidates.end());
+}
+
+TEST_CASE("A polar grid query finds entities across the zero angle boundary")
+{
+    auto centre = sf::Vector2f{960, 540};
+    PolarGrid grid(centre, 540);
+    grid.insert(0, {centre.x - 200, centre.y + 1}, 10); // Just past +180 degrees
+    grid.build();
+
+    auto candidates = queryIndices(grid, {centre.x - 200, centre.y - 1}, 10); // Just before -180 degrees
+    CHECK(candidates.size() == 1);
+}
+
+TEST_CASE("A polar grid query around the centre returns every entity in range once")
+{
+    auto centre = sf::Vector2f{960, 540};
+    PolarGrid grid(centre, 540);
+    for (auto i = 0u; i < 8; i++)
+    {
+        auto angle = common::degreeToRad(i * 45.f);
+        grid.insert(i, {centre.x + 30 * std::cos(angle), centre.y + 30 * std::sin(angle)}, 5);
+    }
+    grid.build();
+
+    auto candidates = queryIndices(grid, centre, 10);
+    CHECK(candidates.size() == 8);
+}
+
+TEST_CASE("A polar grid query's ranges hold every overlapping entity, each once")
+{
+    auto centre = sf::Vector2f{960, 540};
+    PolarGrid grid(centre, 540);
+    std::vector<sf::Vector2f> positions;
+    for (auto i = 0u; i < 64; i++)
+    {
+        auto angle = common::degreeToRad(i * 37.f);
+        auto distance = 20.f + (i * 53) % 500;
+        positions.push_back({centre.x + distance * std::cos(angle), centre.y + distance * std::sin(angle)});
+        grid.insert(i, positions.back(), 15);
+    }
+    grid.build();
+
+    auto position = sf::Vector2f{centre.x + 150, centre.y - 200};
+    auto candidates = queryIndices(grid, position, 10);
+    std::set<unsigned int> unique(candidates.begin(), candidates.end());
+    CHECK(unique.size() == candidates.size());
+    for (auto i = 0u; i < positions.size(); i++)
+    {
+        auto offset = positions[i] - position;
+        if (offset.x * offset.x + offset.y * offset.y <= 25.f * 25.f)
+            CHECK(unique.count(i) == 1);
+    }
+}
+
+////////////////////////////////////////////////////////////
+///  Collision kernel tests
+////////////////////////////////////////////////////////////
+
+TEST_CASE("The collision kernel sets a bit for each overlapping circle")
+{
+    collision::CircleArray circles;
+    circles.push_back({100, 100}, 10); // Overlapping
+    circles.push_back({200, 100}, 10); // Far away
+    circles.push_back({120, 100}, 10); // Exactly touching
+    circles.push_back({100, 125}, 10); // Just out of reach
+    circles.push_back({105, 95}, 1);   // Inside
+
+    auto mask = collision::overlapMask({110, 100}, 10, circles, 0, circles.size());
+    CHECK(mask == 0b10101);
+}
+
+TEST_CASE("The collision kernel agrees with a circle by circle test, for any batch start and length")
+{
+    Random random{3};
+    collision::CircleArray circles;
+    for (auto i = 0; i < 100; i++)
+        circles.push_back({random.nextFloat(0, 200), random.nextFloat(0, 200)}, random.nextFloat(1, 20));
+
+    for (auto test = 0; test < 50; test++)
+    {
+        auto centre = sf::Vector2f{random.nextFloat(0, 200), random.nextFloat(0, 200)};
+        auto radius = random.nextFloat(1, 20);
+        auto first = static_cast<std::size_t>(random.nextInt(70));
+        auto count = static_cast<std::size_t>(random.nextInt(collision::batchSize + 1));
+
+        auto expected = std::uint32_t{0};
+        for (auto i = 0u; i < count; i++)
+        {
+            auto distanceX = circles.x[first + i] - centre.x;
+            auto distanceY = circles.y[first + i] - centre.y;
+            auto reach = circles.radius[first + i] + radius;
+            if (distanceX * distanceX + distanceY * distanceY <= reach * reach)
+                expected |= std::uint32_t{1} << i;
+        }
+        CHECK(collision::overlapMask(centre, radius, circles, first, count) == expected);
+    }
+}
+
 ////////////////////////////////////////////////////////////
 ///  Entity controller tests
 ////////////////////////////////////////////////////////////
 
 TEST_CASE("Calling spawn basic enemy generates an enemy ship in the defined spawn type")
 {
-    TextureHolder textures;
     auto resolution = sf::Vector2i{1920, 1080};
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
 
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -1162,28 +1904,25 @@ TEST_CASE("Calling spawn basic enemy generates an enemy ship in the defined spaw
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     // Lastly, the EntityController needs a score and speedModifier
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     float speedModifier = 1;
-    EntityController entityController(resolution,playerShip,textures,score,speedModifier);
+    EntityController entityController(resolution,playerShip,score,clock,speedModifier);
     //create an arbitary kind of enemy ship, using the entity controller
 
     auto enemySpawnType = entity::Basic;
     entityController.spawnBasicEnemy(enemySpawnType,textures::EnemyShipGrey,MovementDirection::Clockwise,MovementState::SpiralOut);
     //Only one enemy was spawned but the function returns a vector. this Provides a more logical method of itteration
     for(auto &enemy : entityController.getEnemies()){
-        CHECK(enemySpawnType==enemy->getType());
+        CHECK(enemySpawnType==enemy.getType());
     }
 }
 
 TEST_CASE("Calling spawn basic enemy generates an enemy ship in the defined movement direction")
 {
-    TextureHolder textures;
     auto resolution = sf::Vector2i{1920, 1080};
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
 
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -1192,12 +1931,12 @@ TEST_CASE("Calling spawn basic enemy generates an enemy ship in the defined move
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     // Lastly, the EntityController needs a score and speedModifier
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     float speedModifier = 1;
-    EntityController entityController(resolution,playerShip,textures,score,speedModifier);
+    EntityController entityController(resolution,playerShip,score,clock,speedModifier);
     //create an arbitary kind of enemy ship, using the entity controller
 
     auto enemyMoveDirection = MovementDirection::Clockwise;
@@ -1205,16 +1944,13 @@ TEST_CASE("Calling spawn basic enemy generates an enemy ship in the defined move
     //Only one enemy was spawned but the function returns a vector. this Provides a more logical method of itteration
     for(auto &enemy : entityController.getEnemies()){
         //clockwise rotation is represented by a +1 multiplier on direction sign
-                CHECK(enemy->getMovementDirectionSign()==+1);
+                CHECK(enemy.getMovementDirectionSign()==+1);
     }
 }
 
 TEST_CASE("Calling spawn basic enemy generates an enemy ship in the defined movement State")
 {
-    TextureHolder textures;
     auto resolution = sf::Vector2i{1920, 1080};
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
 
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -1223,28 +1959,25 @@ TEST_CASE("Calling spawn basic enemy generates an enemy ship in the defined move
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     // Lastly, the EntityController needs a score and speedModifier
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     float speedModifier = 1;
-    EntityController entityController(resolution,playerShip,textures,score,speedModifier);
+    EntityController entityController(resolution,playerShip,score,clock,speedModifier);
     //create an arbitary kind of enemy ship, using the entity controller
 
     auto enemyMoveState = MovementState::SpiralOut;
     entityController.spawnBasicEnemy(entity::Basic,textures::EnemyShipGrey,MovementDirection::Clockwise,enemyMoveState);
     //Only one enemy was spawned but the function returns a vector. this Provides a more logical method of itteration
     for(auto &enemy : entityController.getEnemies()){
-                CHECK(enemy->getMovementState()==enemyMoveState);
+                CHECK(enemy.getMovementState()==enemyMoveState);
     }
 }
 
 TEST_CASE("Calling spawn spawnSatellites correctly spawns 3 enemies of the right type")
 {
-    TextureHolder textures;
     auto resolution = sf::Vector2i{1920, 1080};
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::Satellite, "resources/satellite.png");
 
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -1253,13 +1986,13 @@ TEST_CASE("Calling spawn spawnSatellites correctly spawns 3 enemies of the right
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     // Lastly, the EntityController needs a score and speedModifier
     playerShip.update();
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     float speedModifier = 1;
-    EntityController entityController(resolution,playerShip,textures,score,speedModifier);
+    EntityController entityController(resolution,playerShip,score,clock,speedModifier);
     //create an arbitary kind of enemy ship, using the entity controller
 
     auto enemyType = entity::Satellite;
@@ -1271,20 +2004,17 @@ TEST_CASE("Calling spawn spawnSatellites correctly spawns 3 enemies of the right
 auto numberOfShipsSpawned = 0;
     for(auto &enemy : entityController.getEnemies()){
         numberOfShipsSpawned++;
-        CHECK(enemy->getType()==enemyType);
-        CHECK(enemy->getMovementState()==enemyMoveState);
-        CHECK(enemy->getAngle()>ExpectedAngle-90); //Satellites spawn in a random range opposite the player
-        CHECK(enemy->getAngle()<ExpectedAngle+90);
+        CHECK(enemy.getType()==enemyType);
+        CHECK(enemy.getMovementState()==enemyMoveState);
+        CHECK(enemy.getAngle()>ExpectedAngle-90); //Satellites spawn in a random range opposite the player
+        CHECK(enemy.getAngle()<ExpectedAngle+90);
     }
     CHECK(numberOfShipsSpawned==3); //should spawn 3 satellites
 }
 
 TEST_CASE("Calling spawn Meteorid actually spawns a meteorid")
 {
-    TextureHolder textures;
     auto resolution = sf::Vector2i{1920, 1080};
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
 
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -1293,12 +2023,12 @@ TEST_CASE("Calling spawn Meteorid actually spawns a meteorid")
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     // Lastly, the EntityController needs a score and speedModifier
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     float speedModifier = 1;
-    EntityController entityController(resolution,playerShip,textures,score,speedModifier);
+    EntityController entityController(resolution,playerShip,score,clock,speedModifier);
     //create an arbitary kind of enemy ship, using the entity controller
 
     entityController.spawnMeteoroid();
@@ -1312,11 +2042,7 @@ TEST_CASE("Calling spawn Meteorid actually spawns a meteorid")
 
 TEST_CASE("Calling killAllEnemiesOfType removes all of that type")
 {
-    TextureHolder textures;
     auto resolution = sf::Vector2i{1920, 1080};
-    textures.load(textures::PlayerShip, "resources/player_ship_animated.png");
-    textures.load(textures::EnemyShipGrey, "resources/enemyship_grey.png");
-    textures.load(textures::Satellite, "resources/satellite.png");
 
     auto shipPathRadiusPadding = 0.05f;
     auto shipScale = 1;
@@ -1325,12 +2051,12 @@ TEST_CASE("Calling killAllEnemiesOfType removes all of that type")
                           shipPathRadius,
                           0,
                           shipScale,
-                          entity::PlayerShip,
-                          textures);
+                          entity::PlayerShip);
     // Lastly, the EntityController needs a score and speedModifier
-    Score score;
+    SimulationClock clock;
+    Score score(clock);
     float speedModifier = 1;
-    EntityController entityController(resolution,playerShip,textures,score,speedModifier);
+    EntityController entityController(resolution,playerShip,score,clock,speedModifier);
     //create an arbitary kind of enemy ship, using the entity controller
     entityController.spawnSatellites();
     entityController.spawnBasicEnemy(entity::Basic,textures::EnemyShipGrey,MovementDirection::Clockwise,MovementState::SpiralOut);
@@ -1344,7 +2070,32 @@ TEST_CASE("Calling killAllEnemiesOfType removes all of that type")
     auto numberOfEnemiesLeft = 0;
     for(auto &enemy : entityController.getEnemies()){
         numberOfEnemiesLeft++;
-        CHECK(enemy->getType()!=entity::Satellite); //verify no satellits are left
+        CHECK(enemy.getType()!=entity::Satellite); //verify no satellits are left
     }
             CHECK(numberOfEnemiesLeft==1); //should have spawned one basic and one satellite
-}
\ No newline at end of file
+}
+
+TEST_CASE("Two entity controllers with the same random seed spawn the same enemies")
+{
+    auto resolution = sf::Vector2i{1920, 1080};
+    auto shipPathRadius = (resolution.y / 2) - (resolution.y * 0.05f);
+    PlayerShip playerShip(resolution,
+                          shipPathRadius,
+                          0,
+                          1,
+                          entity::PlayerShip);
+    SimulationClock clock;
+    Score score(clock);
+    EntityController entityController1(resolution,playerShip,score,clock,1,Random{42});
+    EntityController entityController2(resolution,playerShip,score,clock,1,Random{42});
+    entityController1.spawnBasicEnemy(entity::BasicWanderer,textures::EnemyShipYellow,MovementDirection::Clockwise,MovementState::Wandering);
+    entityController2.spawnBasicEnemy(entity::BasicWanderer,textures::EnemyShipYellow,MovementDirection::Clockwise,MovementState::Wandering);
+    auto enemy1 = entityController1.getEnemies().front();
+    auto enemy2 = entityController2.getEnemies().front();
+    CHECK(enemy1.getAngle() == enemy2.getAngle());
+    CHECK(enemy1.getDistanceFromCentre() == enemy2.getDistanceFromCentre());
+    // Respawning draws from each enemy's own stream, which also match
+    enemy1.reset();
+    enemy2.reset();
+    CHECK(enemy1.getAngle() == enemy2.getAngle());
+}